@@ -0,0 +1,43 @@
+#
+# Copyright (C) 2026 Intel Corporation
+#
+# SPDX-License-Identifier: MIT
+#
+
+# Writes OUTPUT_FILE, a source file defining KernelRegistry::getEmbeddedKernels with the contents of
+# KERNEL_FILES (separated with |) as constant arrays. Run in script mode at build time, so changed
+# kernels are built in again.
+
+string(REPLACE "|" ";" KERNEL_FILES "${KERNEL_FILES}")
+string(REPEAT "0x[0-9a-f][0-9a-f]," 16 LINE_OF_BYTES)
+
+set(ARRAYS "")
+set(ENTRIES "")
+set(INDEX 0)
+foreach(KERNEL_FILE ${KERNEL_FILES})
+    get_filename_component(KERNEL_NAME "${KERNEL_FILE}" NAME)
+    file(SIZE "${KERNEL_FILE}" KERNEL_SIZE)
+    file(READ "${KERNEL_FILE}" CONTENT HEX)
+
+    # 16 bytes per line, followed by a null character not counted in the size
+    string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," CONTENT "${CONTENT}")
+    string(REGEX REPLACE "(${LINE_OF_BYTES})" "\\1\n    " CONTENT "${CONTENT}")
+    string(APPEND ARRAYS "constexpr uint8_t kernel${INDEX}[] = {\n    ${CONTENT}0x00};\n")
+    string(APPEND ENTRIES "    {\"${KERNEL_NAME}\", {kernel${INDEX}, ${KERNEL_SIZE}}},\n")
+    math(EXPR INDEX "${INDEX} + 1")
+endforeach()
+
+file(WRITE "${OUTPUT_FILE}" "// Generated by cmake/EmbedKernels.cmake, do not edit
+
+#include \"framework/utility/kernel_registry.h\"
+
+namespace {
+${ARRAYS}
+constexpr KernelRegistry::EmbeddedKernel embeddedKernels[] = {
+${ENTRIES}};
+} // namespace
+
+std::span<const KernelRegistry::EmbeddedKernel> KernelRegistry::getEmbeddedKernels() {
+    return embeddedKernels;
+}
+")
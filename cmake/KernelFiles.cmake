@@ -4,8 +4,8 @@
 # SPDX-License-Identifier: MIT
 #
 
+# Kernel files are built into the framework library by EmbedKernels.cmake, not copied next to the benchmarks
 set(KERNELS_SOURCE_DIR "${CMAKE_SOURCE_DIR}/source/kernels")
-set(KERNELS_OUTPUT_DIR "${OUTPUT_DIR}")
 
 include(${CMAKE_MODULE_PATH}/${BRANCH_TYPE}/CopyKernelsAdditional.cmake OPTIONAL)
 
@@ -18,8 +18,3 @@ foreach(EXTENSION ${KERNEL_EXTENSIONS})
     )
     list(APPEND KERNEL_FILES ${EXTENSION_FILES})
 endforeach()
-
-file(MAKE_DIRECTORY "${KERNELS_OUTPUT_DIR}")
-foreach(KERNEL_FILE ${KERNEL_FILES})
-    configure_file("${KERNEL_FILE}" "${KERNELS_OUTPUT_DIR}" COPYONLY)
-endforeach()
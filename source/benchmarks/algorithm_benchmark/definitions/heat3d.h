@@ -42,4 +42,8 @@ struct Heat3D : TestCase<Heat3DArguments> {
         return "A 3D heat-equation solving benchmark that overlaps IPC data transfers (nearest-neighbor halo exchange) and GPU compute kernels."
                "Measures multi-process concurrent kernel execution and IPC memory transfer performance on a single device. Linux-only.";
     }
+
+    bool mustRunAlone() const override {
+        return true; // starts its own processes, which would compete with other shards
+    }
 };
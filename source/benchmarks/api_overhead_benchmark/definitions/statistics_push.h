@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/argument/basic_argument.h"
+#include "framework/test_case/test_case.h"
+
+struct StatisticsPushArguments : TestCaseArgumentContainer {
+    PositiveIntegerArgument metricCount;
+    PositiveIntegerArgument pushCount;
+    BooleanArgument useHandles;
+
+    StatisticsPushArguments()
+        : metricCount(*this, "metricCount", "Number of metrics pushed in each round"),
+          pushCount(*this, "pushCount", "Number of rounds of pushes to measure"),
+          useHandles(*this, "useHandles", "Push through handles returned by registerMetric instead of looking metrics up by description") {}
+};
+
+struct StatisticsPush : TestCase<StatisticsPushArguments> {
+    using TestCase<StatisticsPushArguments>::TestCase;
+
+    std::string getTestCaseName() const override {
+        return "StatisticsPush";
+    }
+
+    std::string getHelp() const override {
+        return "measures time spent by the benchmark framework itself to record a single sample. It does not call any driver API.";
+    }
+};
@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "definitions/statistics_push.h"
+
+#include "framework/test_case/register_test_case.h"
+
+#include <gtest/gtest.h>
+
+[[maybe_unused]] static const inline RegisterTestCase<StatisticsPush> registerTestCase{};
+
+class StatisticsPushTest : public ::testing::TestWithParam<std::tuple<size_t, size_t, bool>> {
+};
+
+TEST_P(StatisticsPushTest, Test) {
+    StatisticsPushArguments args{};
+    args.api = Api::L0;
+    args.metricCount = std::get<0>(GetParam());
+    args.pushCount = std::get<1>(GetParam());
+    args.useHandles = std::get<2>(GetParam());
+
+    StatisticsPush test;
+    test.run(args);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    StatisticsPushTest,
+    StatisticsPushTest,
+    ::testing::Combine(
+        ::testing::Values(1, 5),
+        ::testing::Values(1000),
+        ::testing::Values(false, true)));
@@ -7,7 +7,7 @@
 
 #include "framework/l0/levelzero.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/append_launch_kernel.h"
@@ -27,7 +27,7 @@ static TestResult run(const AppendLaunchKernelArguments &arguments, Statistics &
     Timer timer;
 
     // Create kernel
-    auto spirvModule = FileHelper::loadBinaryFile("api_overhead_benchmark_empty_kernel.spv");
+    auto spirvModule = KernelRegistry::get("api_overhead_benchmark_empty_kernel.spv");
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -65,7 +65,7 @@ static TestResult run(const AppendLaunchKernelArguments &arguments, Statistics &
     cmdListDesc.commandQueueGroupOrdinal = levelzero.commandQueueDesc.ordinal;
 
     // Benchmark
-    for (auto i = 0u; i < arguments.iterations; ++i) {
+    while (statistics.needsMoreSamples()) {
         ze_command_list_handle_t cmdList;
         ASSERT_ZE_RESULT_SUCCESS(zeCommandListCreate(levelzero.context, levelzero.device, &cmdListDesc, &cmdList));
 
@@ -7,7 +7,7 @@
 
 #include "framework/l0/levelzero.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/execute_command_list_immediate.h"
@@ -28,7 +28,7 @@ static TestResult run(const ExecuteCommandListImmediateArguments &arguments, Sta
     Timer timer;
 
     // Create kernel
-    auto spirvModule = FileHelper::loadBinaryFile("api_overhead_benchmark_eat_time.spv");
+    auto spirvModule = KernelRegistry::get("api_overhead_benchmark_eat_time.spv");
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
     }
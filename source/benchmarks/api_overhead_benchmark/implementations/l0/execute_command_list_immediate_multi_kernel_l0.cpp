@@ -7,7 +7,7 @@
 
 #include "framework/l0/levelzero.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/execute_command_list_immediate_multi_kernel.h"
@@ -28,11 +28,11 @@ static TestResult run(const ExecuteCommandListImmediateMultiKernelArguments &arg
     Timer timer;
 
     // Create kernel
-    auto spirvModule0 = FileHelper::loadBinaryFile("api_overhead_benchmark_eat_time.spv");
+    auto spirvModule0 = KernelRegistry::get("api_overhead_benchmark_eat_time.spv");
     if (spirvModule0.size() == 0) {
         return TestResult::KernelNotFound;
     }
-    auto spirvModule1 = FileHelper::loadBinaryFile("api_overhead_benchmark_write_one.spv");
+    auto spirvModule1 = KernelRegistry::get("api_overhead_benchmark_write_one.spv");
     if (spirvModule1.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -7,7 +7,7 @@
 
 #include "framework/l0/levelzero.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/execute_command_list_with_indirect_access.h"
@@ -34,7 +34,7 @@ static TestResult run(const ExecuteCommandListWithIndirectAccessArguments &argum
     Timer timer;
 
     // Create kernel
-    auto spirvModule = FileHelper::loadBinaryFile("api_overhead_benchmark_indirect_access_kernel.spv");
+    auto spirvModule = KernelRegistry::get("api_overhead_benchmark_indirect_access_kernel.spv");
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -8,7 +8,7 @@
 #include "framework/l0/levelzero.h"
 #include "framework/l0/utility/usm_helper.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/execute_command_list_with_indirect.h"
@@ -29,7 +29,7 @@ run(const ExecuteCommandListWithIndirectArguments &arguments, Statistics &statis
     Timer timer;
 
     // Create kernel
-    auto spirvModule = FileHelper::loadBinaryFile("api_overhead_benchmark_empty_kernel.spv");
+    auto spirvModule = KernelRegistry::get("api_overhead_benchmark_empty_kernel.spv");
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
     }
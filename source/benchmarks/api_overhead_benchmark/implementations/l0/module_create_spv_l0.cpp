@@ -7,7 +7,7 @@
 
 #include "framework/l0/levelzero.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/module_create_spv.h"
@@ -27,7 +27,7 @@ static TestResult run(const ModuleCreateSpvArguments &arguments, Statistics &sta
     Timer timer;
 
     // Create module description
-    auto spirvModule = FileHelper::loadBinaryFile(arguments.kernelName);
+    auto spirvModule = KernelRegistry::get(arguments.kernelName);
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
     }
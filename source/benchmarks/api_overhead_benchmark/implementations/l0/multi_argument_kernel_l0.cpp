@@ -8,7 +8,7 @@
 #include "framework/l0/levelzero.h"
 #include "framework/l0/utility/usm_helper.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/multi_argument_kernel.h"
@@ -31,7 +31,7 @@ static TestResult run(const MultiArgumentKernelTimeArguments &arguments, Statist
     Timer timer;
 
     // Create kernel
-    auto spirvModule = FileHelper::loadBinaryFile("api_overhead_benchmark_multi_arg_kernel.spv");
+    auto spirvModule = KernelRegistry::get("api_overhead_benchmark_multi_arg_kernel.spv");
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
     }
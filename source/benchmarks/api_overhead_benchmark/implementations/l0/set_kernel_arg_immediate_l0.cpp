@@ -7,7 +7,7 @@
 
 #include "framework/l0/levelzero.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/set_kernel_arg_immediate.h"
@@ -58,7 +58,7 @@ static TestResult run(const KernelSetArgumentValueImmediateArguments &arguments,
     }
 
     // Create kernel
-    auto spirvModule = FileHelper::loadBinaryFile(std::string("api_overhead_benchmark_") + std::to_string(arguments.argumentSize) + "bytes_argument.spv");
+    auto spirvModule = KernelRegistry::get(std::string("api_overhead_benchmark_") + std::to_string(arguments.argumentSize) + "bytes_argument.spv");
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -81,7 +81,7 @@ static TestResult run(const KernelSetArgumentValueImmediateArguments &arguments,
     st_input_2048 kernelArgument2048{};
 
     // Benchmark
-    for (auto i = 0u; i < arguments.iterations; i++) {
+    while (statistics.needsMoreSamples()) {
         if (arguments.differentValues) {
             ++kernelArgument8.values[1];
             ++kernelArgument64.values[15];
@@ -125,6 +125,7 @@ static TestResult run(const KernelSetArgumentValueImmediateArguments &arguments,
             return TestResult::InvalidArgs;
         }
         statistics.pushValue(timer.get(), typeSelector.getUnit(), typeSelector.getType());
+        statistics.endIteration();
     }
     ASSERT_ZE_RESULT_SUCCESS(zeKernelDestroy(kernel));
     ASSERT_ZE_RESULT_SUCCESS(zeModuleDestroy(module));
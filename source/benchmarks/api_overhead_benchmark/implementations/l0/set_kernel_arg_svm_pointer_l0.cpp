@@ -8,7 +8,7 @@
 #include "framework/l0/levelzero.h"
 #include "framework/l0/utility/usm_helper.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/set_kernel_arg_svm_pointer.h"
@@ -35,7 +35,7 @@ static TestResult run(const SetKernelArgSvmPointerArguments &arguments, Statisti
     Timer timer;
 
     // Create kernels
-    const auto spirvModule = FileHelper::loadBinaryFile("api_overhead_benchmark_indirect_access_kernel.spv");
+    const auto spirvModule = KernelRegistry::get("api_overhead_benchmark_indirect_access_kernel.spv");
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
     }
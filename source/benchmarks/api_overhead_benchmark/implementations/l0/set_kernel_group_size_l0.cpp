@@ -8,7 +8,7 @@
 #include "framework/l0/levelzero.h"
 #include "framework/l0/utility/usm_helper.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/set_kernel_group_size.h"
@@ -28,7 +28,7 @@ static TestResult run(const SetKernelGroupSizeArguments &arguments, Statistics &
     Timer timer;
 
     // Create kernel
-    auto spirvModule = FileHelper::loadBinaryFile("api_overhead_benchmark_write_sum_local.spv");
+    auto spirvModule = KernelRegistry::get("api_overhead_benchmark_write_sum_local.spv");
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/test_case/register_test_case.h"
+#include "framework/test_case/test_case_statistics.h"
+#include "framework/utility/timer.h"
+
+#include "definitions/statistics_push.h"
+
+#include <gtest/gtest.h>
+
+static TestResult run(const StatisticsPushArguments &arguments, Statistics &statistics) {
+    MeasurementFields typeSelector(MeasurementUnit::Microseconds, MeasurementType::Cpu);
+
+    if (isNoopRun()) {
+        statistics.pushUnitAndType(typeSelector.getUnit(), typeSelector.getType());
+        return TestResult::Nooped;
+    }
+
+    // Setup
+    Timer timer;
+    std::vector<std::string> descriptions(arguments.metricCount);
+    for (auto metricIndex = 0u; metricIndex < descriptions.size(); metricIndex++) {
+        descriptions[metricIndex] = "metric" + std::to_string(metricIndex);
+    }
+    const Statistics::Clock::duration pushedValue = std::chrono::microseconds(1);
+    const size_t pushesPerIteration = arguments.metricCount * arguments.pushCount;
+
+    // Metrics are created and storage for all their samples is allocated before measuring, so only
+    // the cost of recording a sample remains. Measurements of the run itself are disabled, they would
+    // be taken by the pushes measured here.
+    TestCaseStatistics measuredStatistics(arguments.iterations * arguments.pushCount + 1, Configuration::PrintType::Noop, false);
+    std::vector<Statistics::MetricHandle> handles(arguments.metricCount);
+    for (auto metricIndex = 0u; metricIndex < handles.size(); metricIndex++) {
+        if (arguments.useHandles) {
+            handles[metricIndex] = measuredStatistics.registerMetric(MeasurementUnit::Microseconds, MeasurementType::Cpu, descriptions[metricIndex]);
+            measuredStatistics.pushValue(handles[metricIndex], pushedValue);
+        } else {
+            measuredStatistics.pushValue(pushedValue, MeasurementUnit::Microseconds, MeasurementType::Cpu, descriptions[metricIndex]);
+        }
+    }
+
+    // Benchmark
+    for (auto i = 0u; i < arguments.iterations; i++) {
+        timer.measureStart();
+        for (auto pushIndex = 0u; pushIndex < arguments.pushCount; pushIndex++) {
+            for (auto metricIndex = 0u; metricIndex < descriptions.size(); metricIndex++) {
+                if (arguments.useHandles) {
+                    measuredStatistics.pushValue(handles[metricIndex], pushedValue);
+                } else {
+                    measuredStatistics.pushValue(pushedValue, MeasurementUnit::Microseconds, MeasurementType::Cpu, descriptions[metricIndex]);
+                }
+            }
+        }
+        timer.measureEnd();
+
+        statistics.pushValue(timer.get() / pushesPerIteration, typeSelector.getUnit(), typeSelector.getType());
+        statistics.endIteration();
+    }
+    return TestResult::Success;
+}
+
+static RegisterTestCaseImplementation<StatisticsPush> registerTestCase(run, Api::L0);
@@ -8,7 +8,7 @@
 #include "framework/l0/levelzero.h"
 #include "framework/test_case/register_test_case.h"
 #include "framework/utility/combo_profiler.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 
 #include "definitions/submit_kernel.h"
 
@@ -29,7 +29,7 @@ static TestResult run(const SubmitKernelArguments &arguments, Statistics &statis
     const ze_group_count_t groupCount{1, 1, 1};
 
     // Create kernel
-    auto spirvModule = FileHelper::loadBinaryFile("api_overhead_benchmark_eat_time.spv");
+    auto spirvModule = KernelRegistry::get("api_overhead_benchmark_eat_time.spv");
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -8,7 +8,7 @@
 #include "framework/ocl/opencl.h"
 #include "framework/ocl/utility/usm_helper_ocl.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/multi_argument_kernel.h"
@@ -36,7 +36,7 @@ static TestResult run(const MultiArgumentKernelTimeArguments &arguments, Statist
     const size_t lws[3] = {arguments.lws, 1, 1};
 
     // Create kernels
-    const std::vector<uint8_t> kernelSource = FileHelper::loadTextFile("api_overhead_benchmark_multi_arg_kernel.cl");
+    const auto kernelSource = KernelRegistry::get("api_overhead_benchmark_multi_arg_kernel.cl");
     if (kernelSource.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -8,7 +8,7 @@
 #include "framework/ocl/opencl.h"
 #include "framework/ocl/utility/usm_helper_ocl.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/set_kernel_arg_svm_pointer.h"
@@ -32,7 +32,7 @@ static TestResult run(const SetKernelArgSvmPointerArguments &arguments, Statisti
     }
 
     // Create kernels
-    const std::vector<uint8_t> kernelSource = FileHelper::loadTextFile("api_overhead_benchmark_fill_with_ones.cl");
+    const auto kernelSource = KernelRegistry::get("api_overhead_benchmark_fill_with_ones.cl");
     if (kernelSource.size() == 0) {
         return TestResult::KernelNotFound;
     }
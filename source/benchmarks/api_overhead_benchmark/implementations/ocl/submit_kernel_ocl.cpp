@@ -7,7 +7,7 @@
 
 #include "framework/ocl/opencl.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/submit_kernel.h"
@@ -32,7 +32,7 @@ static TestResult run(const SubmitKernelArguments &arguments, Statistics &statis
     const size_t lws = 1u;
 
     // Create kernel
-    auto spirvModule = FileHelper::loadBinaryFile("api_overhead_benchmark_eat_time.spv");
+    auto spirvModule = KernelRegistry::get("api_overhead_benchmark_eat_time.spv");
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -9,7 +9,7 @@
 #include "framework/ur/error.h"
 #include "framework/ur/ur.h"
 #include "framework/utility/combo_profiler.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 
 #include "definitions/submit_kernel.h"
 
@@ -33,7 +33,7 @@ static TestResult run(const SubmitKernelArguments &arguments, Statistics &statis
     UrState ur;
 
     // Create kernel
-    auto spirvModule = FileHelper::loadBinaryFile("api_overhead_benchmark_eat_time.spv");
+    auto spirvModule = KernelRegistry::get("api_overhead_benchmark_eat_time.spv");
     if (spirvModule.size() == 0)
         return TestResult::KernelNotFound;
 
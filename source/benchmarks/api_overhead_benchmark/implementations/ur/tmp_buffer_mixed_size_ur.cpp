@@ -8,7 +8,7 @@
 #include "framework/test_case/register_test_case.h"
 #include "framework/ur/error.h"
 #include "framework/ur/ur.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/tmp_buffer_mixed_size.h"
@@ -109,7 +109,7 @@ static TestResult run(const TmpBufferMixedSizeArguments &arguments, Statistics &
     }
 
     // Create kernel
-    auto spirvModule = FileHelper::loadBinaryFile("api_overhead_benchmark_fill_with_ones.spv");
+    auto spirvModule = KernelRegistry::get("api_overhead_benchmark_fill_with_ones.spv");
     if (spirvModule.size() == 0)
         return TestResult::KernelNotFound;
 
@@ -7,7 +7,7 @@
 
 #include "framework/l0/levelzero.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/math_operation_helper.h"
 #include "framework/utility/timer.h"
 
@@ -55,11 +55,10 @@ static TestResult run(const OneAtomicExplicitArguments &arguments, Statistics &s
 
     // Create kernel
     const char *programName = "atomic_benchmark_kernel.cl";
-    auto sourceBytes = FileHelper::loadBinaryFile(programName);
+    auto sourceBytes = KernelRegistry::get(programName);
     if (sourceBytes.size() == 0) {
         return TestResult::KernelNotFound;
     }
-    sourceBytes.push_back('\0');
     const std::string compilerOptions = KernelHelper::getCompilerOptionsExplicit(arguments.dataType, arguments.atomicOperation, arguments.memoryOrder, arguments.scope, otherArgumentsBufferEntryCount);
     ze_module_handle_t module{};
     ze_module_desc_t moduleDesc{ZE_STRUCTURE_TYPE_MODULE_DESC};
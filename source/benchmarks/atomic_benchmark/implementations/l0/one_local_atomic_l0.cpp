@@ -7,7 +7,7 @@
 
 #include "framework/l0/levelzero.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/math_operation_helper.h"
 #include "framework/utility/timer.h"
 
@@ -73,11 +73,10 @@ static TestResult run(const OneLocalAtomicArguments &arguments, Statistics &stat
 
     // Create kernel
     const char *programName = "atomic_benchmark_kernel.cl";
-    auto sourceBytes = FileHelper::loadBinaryFile(programName);
+    auto sourceBytes = KernelRegistry::get(programName);
     if (sourceBytes.size() == 0) {
         return TestResult::KernelNotFound;
     }
-    sourceBytes.push_back('\0');
     const std::string compilerOptions = KernelHelper::getCompilerOptions(arguments.dataType, arguments.atomicOperation, otherArgumentsBufferSize);
     ze_module_handle_t module{};
     ze_kernel_handle_t kernel{};
@@ -1,15 +1,16 @@
 /*
- * Copyright (C) 2026 Intel Corporation
+ * Copyright (C) 2026-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "framework/l0/levelzero.h"
+#include "framework/l0/utility/kernel_helper_l0.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/cpu_time_timer.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
-#include "framework/utility/windows/cpu_time_timer.h"
 
 #include "definitions/event_host_synchronize.h"
 
@@ -47,7 +48,7 @@ static TestResult run(const EventHostSynchronizeArguments &arguments, Statistics
     CpuTimeTimer threadCpuTimer(CpuTimeTimer::Scope::Thread);
     CpuTimeTimer processCpuTimer(CpuTimeTimer::Scope::Process);
 
-    auto spirvModule = FileHelper::loadBinaryFile("cpu_efficiency_benchmark_eat_time.spv");
+    auto spirvModule = KernelRegistry::get("cpu_efficiency_benchmark_eat_time.spv");
     if (spirvModule.empty()) {
         return TestResult::KernelNotFound;
     }
@@ -57,7 +58,7 @@ static TestResult run(const EventHostSynchronizeArguments &arguments, Statistics
     moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
     moduleDesc.pInputModule = reinterpret_cast<const uint8_t *>(spirvModule.data());
     moduleDesc.inputSize = spirvModule.size();
-    ASSERT_ZE_RESULT_SUCCESS(zeModuleCreate(levelzero.context, levelzero.device, &moduleDesc, &module, nullptr));
+    ASSERT_ZE_RESULT_SUCCESS(L0::KernelHelper::createModule(levelzero, moduleDesc, &module));
 
     ze_kernel_handle_t kernel{};
     ze_kernel_desc_t kernelDesc{ZE_STRUCTURE_TYPE_KERNEL_DESC};
@@ -76,11 +77,10 @@ static TestResult run(const EventHostSynchronizeArguments &arguments, Statistics
             eventFlags |= ZE_EVENT_COUNTER_BASED_FLAG_DEVICE_TIMESTAMP;
         }
 
-        ze_event_counter_based_desc_t eventDesc{.stype = ZE_STRUCTURE_TYPE_EVENT_COUNTER_BASED_DESC,
-                                                .pNext = nullptr,
-                                                .flags = eventFlags,
-                                                .signal = ZE_EVENT_SCOPE_FLAG_HOST,
-                                                .wait = ZE_EVENT_SCOPE_FLAG_HOST};
+        ze_event_counter_based_desc_t eventDesc{ZE_STRUCTURE_TYPE_EVENT_COUNTER_BASED_DESC};
+        eventDesc.flags = eventFlags;
+        eventDesc.signal = ZE_EVENT_SCOPE_FLAG_HOST;
+        eventDesc.wait = ZE_EVENT_SCOPE_FLAG_HOST;
         ASSERT_ZE_RESULT_SUCCESS(zeEventCounterBasedCreate(levelzero.context, levelzero.device, &eventDesc, &event));
     } else {
         ze_event_pool_desc_t eventPoolDesc{ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
@@ -111,6 +111,12 @@ static TestResult run(const EventHostSynchronizeArguments &arguments, Statistics
     const auto batchCount = static_cast<size_t>(arguments.batchSize);
     const auto batchSize = static_cast<Timer::Clock::duration::rep>(static_cast<size_t>(arguments.batchSize));
 
+    const auto latencyMetric = statistics.registerMetric(latencySelector.getUnit(), latencySelector.getType(), "latency");
+    const auto threadCpuTimeMetric = statistics.registerMetric(MeasurementUnit::Microseconds, MeasurementType::Cpu, "threadCpuTime");
+    const auto threadCpuUtilizationMetric = statistics.registerMetric(MeasurementUnit::Percentage, MeasurementType::Cpu, "threadCpuUtilization");
+    const auto processCpuTimeMetric = statistics.registerMetric(MeasurementUnit::Microseconds, MeasurementType::Cpu, "processCpuTime");
+    const auto processCpuUtilizationMetric = statistics.registerMetric(MeasurementUnit::Percentage, MeasurementType::Cpu, "processCpuUtilization");
+
     for (auto i = 0u; i < arguments.iterations; i++) {
         Timer::Clock::duration totalWallTime{};
         std::chrono::nanoseconds totalThreadCpuTime{};
@@ -138,11 +144,12 @@ static TestResult run(const EventHostSynchronizeArguments &arguments, Statistics
             }
         }
 
-        statistics.pushValue(totalWallTime / batchSize, latencySelector.getUnit(), latencySelector.getType(), "latency");
-        statistics.pushValue(std::chrono::duration_cast<Statistics::Clock::duration>(totalThreadCpuTime / batchSize), MeasurementUnit::Microseconds, MeasurementType::Cpu, "threadCpuTime");
-        statistics.pushPercentage(getCpuUtilizationPercent(totalThreadCpuTime, totalWallTime), MeasurementUnit::Percentage, MeasurementType::Cpu, "threadCpuUtilization");
-        statistics.pushValue(std::chrono::duration_cast<Statistics::Clock::duration>(totalProcessCpuTime / batchSize), MeasurementUnit::Microseconds, MeasurementType::Cpu, "processCpuTime");
-        statistics.pushPercentage(getCpuUtilizationPercent(totalProcessCpuTime, totalWallTime), MeasurementUnit::Percentage, MeasurementType::Cpu, "processCpuUtilization");
+        statistics.pushValue(latencyMetric, totalWallTime / batchSize);
+        statistics.pushValue(threadCpuTimeMetric, std::chrono::duration_cast<Statistics::Clock::duration>(totalThreadCpuTime / batchSize));
+        statistics.pushPercentage(threadCpuUtilizationMetric, getCpuUtilizationPercent(totalThreadCpuTime, totalWallTime));
+        statistics.pushValue(processCpuTimeMetric, std::chrono::duration_cast<Statistics::Clock::duration>(totalProcessCpuTime / batchSize));
+        statistics.pushPercentage(processCpuUtilizationMetric, getCpuUtilizationPercent(totalProcessCpuTime, totalWallTime));
+        statistics.endIteration();
     }
 
     ASSERT_ZE_RESULT_SUCCESS(zeCommandListDestroy(cmdList));
@@ -7,7 +7,7 @@
 
 #include "framework/l0/levelzero.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/barrier_between_kernels.h"
@@ -78,7 +78,7 @@ static TestResult run(const BarrierBetweenKernelsArguments &arguments, Statistic
     }
 
     // Create kernel
-    auto spirvModule = FileHelper::loadBinaryFile("gpu_cmds_benchmark_write_one_global_ids_with_check.spv");
+    auto spirvModule = KernelRegistry::get("gpu_cmds_benchmark_write_one_global_ids_with_check.spv");
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -7,7 +7,7 @@
 
 #include "framework/l0/levelzero.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/empty_kernel.h"
@@ -35,7 +35,7 @@ static TestResult run(const EmptyKernelArguments &arguments, Statistics &statist
     uint64_t *endTimestamp = beginTimestamp + 1;
 
     // Create kernel
-    auto spirvModule = FileHelper::loadBinaryFile("gpu_cmds_benchmark_empty_kernel.spv");
+    auto spirvModule = KernelRegistry::get("gpu_cmds_benchmark_empty_kernel.spv");
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -7,7 +7,7 @@
 
 #include "framework/l0/levelzero.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/kernel_with_work.h"
@@ -55,7 +55,7 @@ static TestResult run(const KernelWithWorkArguments &arguments, Statistics &stat
     ASSERT_ZE_RESULT_SUCCESS(zeContextMakeMemoryResident(levelzero.context, levelzero.device, outputBuffer, outputBufferSize))
 
     // Create kernel
-    auto spirvModule = FileHelper::loadBinaryFile(selectKernel(arguments.usedIds));
+    auto spirvModule = KernelRegistry::get(selectKernel(arguments.usedIds));
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
     }
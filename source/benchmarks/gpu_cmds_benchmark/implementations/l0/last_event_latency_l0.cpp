@@ -7,7 +7,7 @@
 
 #include "framework/l0/levelzero.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/last_event_latency.h"
@@ -31,7 +31,7 @@ static TestResult run([[maybe_unused]] const LastEventLatencyArguments &argument
     auto context = zeDriverGetDefaultContext(levelzero.driver);
 
     // Create kernel
-    auto spirvModule = FileHelper::loadBinaryFile("gpu_cmds_benchmark_write_one_global_ids.spv");
+    auto spirvModule = KernelRegistry::get("gpu_cmds_benchmark_write_one_global_ids.spv");
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -7,7 +7,7 @@
 
 #include "framework/l0/levelzero.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/wait_on_event_from_walker.h"
@@ -26,7 +26,7 @@ struct TestResourcesForWaitOnWalker {
             ZE_RESULT_SUCCESS_OR_ERROR(zeEventCreate(this->eventPool, &eventDesc, &event));
         }
 
-        auto spirvModule = FileHelper::loadBinaryFile("gpu_cmds_benchmark_empty_kernel.spv");
+        auto spirvModule = KernelRegistry::get("gpu_cmds_benchmark_empty_kernel.spv");
 
         ze_module_desc_t moduleDesc{ZE_STRUCTURE_TYPE_MODULE_DESC};
         moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024-2025 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,7 +7,8 @@
 
 #include "implementations/l0/memory_helper.h"
 
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
+
 namespace mem_helper {
 DataFloatPtr alloc(UsmMemoryPlacement placement, std::shared_ptr<LevelZero> levelzero, uint32_t count) {
     void *deviceptr = nullptr;
@@ -22,7 +23,7 @@ namespace mem_helper {
 TestResult loadKernel(std::shared_ptr<LevelZero> levelzero, std::string spirv_file_name, std::string kernel_name, ze_kernel_handle_t *kernel_out,
                       ze_module_handle_t *module_out) {
     auto spirvModule =
-        FileHelper::loadBinaryFile(spirv_file_name);
+        KernelRegistry::get(spirv_file_name);
 
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
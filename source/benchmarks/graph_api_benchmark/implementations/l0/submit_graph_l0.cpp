@@ -8,7 +8,7 @@
 #include "framework/l0/levelzero.h"
 #include "framework/test_case/register_test_case.h"
 #include "framework/utility/combo_profiler.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 
 #include "definitions/submit_graph.h"
 
@@ -39,7 +39,7 @@ static TestResult run([[maybe_unused]] const SubmitGraphArguments &arguments, St
     }
 
     // Create kernel
-    auto spirvModule = FileHelper::loadBinaryFile("api_overhead_benchmark_eat_time.spv");
+    auto spirvModule = KernelRegistry::get("api_overhead_benchmark_eat_time.spv");
     if (spirvModule.size() == 0)
         return TestResult::KernelNotFound;
     ze_module_handle_t module;
@@ -9,6 +9,7 @@
 
 #include "framework/test_case/test_case.h"
 #include "framework/ur/error.h"
+#include "framework/utility/kernel_registry.h"
 
 Decoder2GraphUR::DataIntPtr Decoder2GraphUR::allocDevice(uint32_t count) {
     void *ptr = nullptr;
@@ -49,7 +50,7 @@ TestResult Decoder2GraphUR::init() {
     ur_queue_properties_t queueProperties = {};
     EXPECT_UR_RESULT_SUCCESS(urQueueCreate(urState->context, urState->device, &queueProperties, &queue));
 
-    auto spirvModule = FileHelper::loadBinaryFile("graph_api_benchmark_kernel_increment.spv");
+    auto spirvModule = KernelRegistry::get("graph_api_benchmark_kernel_increment.spv");
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
     }
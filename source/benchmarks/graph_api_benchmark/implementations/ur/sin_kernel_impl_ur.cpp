@@ -8,6 +8,7 @@
 #include "sin_kernel_impl_ur.h"
 
 #include "framework/test_case/test_result.h"
+#include "framework/utility/kernel_registry.h"
 
 #if __has_include("unified-runtime/ur_api.h")
 #include "unified-runtime/ur_api.h"
@@ -63,9 +64,9 @@ TestResult SinKernelGraphUR::init() {
 
     // Create kernels
     auto spirvModuleA =
-        FileHelper::loadBinaryFile("graph_api_benchmark_kernel_assign.spv");
+        KernelRegistry::get("graph_api_benchmark_kernel_assign.spv");
     auto spirvModuleS =
-        FileHelper::loadBinaryFile("graph_api_benchmark_kernel_sin.spv");
+        KernelRegistry::get("graph_api_benchmark_kernel_sin.spv");
 
     if (spirvModuleA.size() == 0 || spirvModuleS.size() == 0)
         return TestResult::KernelNotFound;
@@ -9,7 +9,7 @@
 #include "framework/l0/levelzero.h"
 #include "framework/l0/utility/error.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/memory_constants.h"
 #include "framework/utility/timer.h"
 
@@ -87,7 +87,7 @@ static TestResult run(const RandomAccessArguments &arguments, Statistics &statis
     }
 
     // Create kernel
-    const auto kernelBinary = FileHelper::loadBinaryFile("access_device_mem_random.spv");
+    const auto kernelBinary = KernelRegistry::get("access_device_mem_random.spv");
     if (kernelBinary.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -10,7 +10,7 @@
 #include "framework/l0/utility/error.h"
 #include "framework/l0/utility/usm_helper.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/memory_constants.h"
 
 #include "definitions/random_access_multi_resource.h"
@@ -65,7 +65,7 @@ static TestResult run(const RandomAccessMultiResourceArguments &arguments, Stati
     }
 
     // Create kernel
-    const auto kernelBinary = FileHelper::loadBinaryFile("access_device_mem_random.spv");
+    const auto kernelBinary = KernelRegistry::get("access_device_mem_random.spv");
     if (kernelBinary.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -7,7 +7,7 @@
 
 #include "framework/l0/levelzero.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/memory_constants.h"
 
 #include "definitions/slm_switch_latency.h"
@@ -42,7 +42,7 @@ static TestResult run(const SlmSwitchLatencyArguments &arguments, Statistics &st
 
     // Create module
     const char *kernelFile = "slm_benchmark.spv";
-    auto spirvModule = FileHelper::loadBinaryFile(kernelFile);
+    auto spirvModule = KernelRegistry::get(kernelFile);
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -7,7 +7,7 @@
 
 #include "framework/l0/levelzero.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/memory_constants.h"
 #include "framework/utility/timer.h"
 
@@ -49,7 +49,7 @@ static TestResult run(const StreamMemoryImmediateArguments &arguments, Statistic
 
     // Create module
     const char *kernelFile = useDoubles ? "memory_benchmark_stream_memory_fp64.spv" : "memory_benchmark_stream_memory.spv";
-    auto spirvModule = FileHelper::loadBinaryFile(kernelFile);
+    auto spirvModule = KernelRegistry::get(kernelFile);
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -13,7 +13,7 @@
 #include "framework/ocl/utility/sub_group_helper.h"
 #include "framework/test_case/register_test_case.h"
 #include "framework/utility/compiler_options_builder.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/memory_constants.h"
 #include "framework/utility/timer.h"
 
@@ -163,7 +163,7 @@ static TestResult run(const SlmTrafficArguments &arguments, Statistics &statisti
             "\n}";
         programSize = strlen(programSlmRead);
     } else {
-        const auto programSrc = FileHelper::loadBinaryFile("slmRead_CryptKernelBased.cl");
+        const auto programSrc = KernelRegistry::get("slmRead_CryptKernelBased.cl");
         if (programSrc.size() == 0) {
             return TestResult::KernelNotFound;
         }
@@ -7,7 +7,7 @@
 
 #include "framework/ocl/opencl.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/ioq_kernel_switch_latency.h"
@@ -39,7 +39,7 @@ static TestResult run(const IoqKernelSwitchLatencyArguments &arguments, Statisti
     ASSERT_CL_SUCCESS(retVal);
 
     // Create kernel
-    const std::vector<uint8_t> kernelSource = FileHelper::loadTextFile("benchmark_write_multiple.cl");
+    const auto kernelSource = KernelRegistry::get("benchmark_write_multiple.cl");
     if (kernelSource.size() == 0) {
         return TestResult::KernelNotFound;
     }
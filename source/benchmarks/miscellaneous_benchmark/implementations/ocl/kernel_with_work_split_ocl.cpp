@@ -8,7 +8,7 @@
 #include "framework/ocl/opencl.h"
 #include "framework/ocl/utility/profiling_helper.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/kernel_with_work_split.h"
@@ -41,7 +41,7 @@ static TestResult run(const KernelWithWorkArgumentsSplit &arguments, Statistics
     cl_mem buffer = clCreateBuffer(opencl.context, CL_MEM_READ_WRITE, bufferSize, nullptr, &retVal);
     ASSERT_CL_SUCCESS(retVal);
 
-    const std::vector<uint8_t> kernelSource = FileHelper::loadTextFile(selectKernel(arguments.usedIds, "cl"));
+    const auto kernelSource = KernelRegistry::get(selectKernel(arguments.usedIds, "cl"));
     if (kernelSource.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -42,4 +42,8 @@ struct MultiProcessImmediateCmdlistCompletion : TestCase<MultiProcessImmediateCm
                "assigned to selected engines one each, in a round-robin method."
                "if selected engineCount == 1, then all processes are assigned to that engine.";
     }
+
+    bool mustRunAlone() const override {
+        return true; // starts its own processes, which would compete with other shards
+    }
 };
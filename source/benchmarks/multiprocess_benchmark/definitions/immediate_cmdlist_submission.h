@@ -30,4 +30,8 @@ struct MultiProcessImmediateCmdlistSubmission : TestCase<MultiProcessImmediateCm
                "assigned to engines one each, in a round-robin method."
                "if engineCount == 1, then all processes are assigned to the engine.";
     }
+
+    bool mustRunAlone() const override {
+        return true; // starts its own processes, which would compete with other shards
+    }
 };
@@ -38,4 +38,8 @@ struct MultiProcessCompute : TestCase<MultiProcessComputeArguments> {
                "compute workload and measures average time to complete all of them. Processes "
                "will use affinity mask to select specific sub-devices for the execution";
     }
+
+    bool mustRunAlone() const override {
+        return true; // starts its own processes, which would compete with other shards
+    }
 };
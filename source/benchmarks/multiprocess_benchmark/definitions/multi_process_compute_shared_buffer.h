@@ -38,4 +38,8 @@ struct MultiProcessComputeSharedBuffer : TestCase<MultiProcessComputeSharedBuffe
                "buffer for each tile is created by parent process. All processes executing on a "
                "given tile will share it via IPC calls. ";
     }
+
+    bool mustRunAlone() const override {
+        return true; // starts its own processes, which would compete with other shards
+    }
 };
@@ -31,4 +31,8 @@ struct MultiProcessInit : TestCase<MultiProcessInitArguments> {
         return "Measures the initialization overhead in a multi-process application."
                "For Level Zero we only measure the first invocation of zeInit() per process execution.";
     }
+
+    bool mustRunAlone() const override {
+        return true; // starts its own processes, which would compete with other shards
+    }
 };
@@ -9,8 +9,8 @@
 #include "framework/l0/levelzero.h"
 #include "framework/l0/utility/usm_helper.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
-#include "framework/utility/timer.h"
+#include "framework/utility/combo_profiler.h"
+#include "framework/utility/kernel_registry.h"
 
 #include "definitions/immediate_cmdlist_submission.h"
 
@@ -24,7 +24,7 @@ struct ThreadSpecificData {
     ze_command_list_handle_t cmdList{};
     ze_event_handle_t event{};
     void *hostMemory = nullptr;
-    Timer timer{};
+    ComboProfilerWithStats profiler{Configuration::get().profilerType};
     ze_kernel_handle_t kernel{};
 };
 
@@ -40,11 +40,11 @@ static void issueToImmediateCmdList(ThreadSpecificData *threadData, std::shared_
     _mm_clflush(threadData->hostMemory);
 
     std::shared_lock sharedLock(*barrier);
-    threadData->timer.measureStart();
+    threadData->profiler.measureStart();
     EXPECT_ZE_RESULT_SUCCESS(zeCommandListAppendLaunchKernel(threadData->cmdList, threadData->kernel, &groupCount, threadData->event, 0, nullptr));
     while (*volatileBuffer != 1) {
     }
-    threadData->timer.measureEnd();
+    threadData->profiler.measureEnd();
     EXPECT_ZE_RESULT_SUCCESS(zeEventHostSynchronize(threadData->event, std::numeric_limits<uint64_t>::max()));
 }
 
@@ -72,10 +72,9 @@ static TestResult getComputeEngineInfo(std::vector<EngineInfo> &supportedEngineI
 }
 
 static TestResult run(const ImmediateCommandListSubmissionArguments &arguments, Statistics &statistics) {
-    MeasurementFields typeSelector(MeasurementUnit::Microseconds, MeasurementType::Cpu);
-
     if (isNoopRun()) {
-        statistics.pushUnitAndType(typeSelector.getUnit(), typeSelector.getType());
+        ComboProfilerWithStats profiler(Configuration::get().profilerType);
+        profiler.pushNoop(statistics);
         return TestResult::Nooped;
     }
     // Setup
@@ -111,7 +110,7 @@ static TestResult run(const ImmediateCommandListSubmissionArguments &arguments,
     const size_t bufferSize = 4096u;
 
     // Create kernel
-    const auto kernelBinary = FileHelper::loadBinaryFile("ulls_benchmark_write_one.spv");
+    const auto kernelBinary = KernelRegistry::get("ulls_benchmark_write_one.spv");
     if (kernelBinary.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -139,6 +138,11 @@ static TestResult run(const ImmediateCommandListSubmissionArguments &arguments,
         ASSERT_ZE_RESULT_SUCCESS(zeEventCreate(eventPool, &eventDesc, &threadData[i].event));
     }
 
+    std::vector<const ComboProfilerWithStats *> threadProfilers{};
+    for (const ThreadSpecificData &data : threadData) {
+        threadProfilers.push_back(&data.profiler);
+    }
+
     std::shared_mutex barrier;
 
     // Benchmark
@@ -154,14 +158,11 @@ static TestResult run(const ImmediateCommandListSubmissionArguments &arguments,
             threads[j]->join();
         }
 
-        auto aggregatedThreadDuration = static_cast<std::chrono::high_resolution_clock::duration>(0);
         for (auto j = 0u; j < arguments.numberOfThreads; j++) {
             zeEventHostReset(threadData[j].event);
-            aggregatedThreadDuration += threadData[j].timer.get();
         }
 
-        const auto averageThreadDuration = aggregatedThreadDuration / arguments.numberOfThreads;
-        statistics.pushValue(averageThreadDuration, MeasurementUnit::Microseconds, MeasurementType::Cpu, "Average Thread Duration");
+        ComboProfilerWithStats::pushAggregatedStats(statistics, threadProfilers, "Average Thread Duration");
     }
 
     // Cleanup
@@ -8,7 +8,7 @@
 #include "framework/l0/levelzero.h"
 #include "framework/l0/utility/usm_helper.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/usm_copy_kernel.h"
@@ -33,7 +33,7 @@ static TestResult run(const UsmCopyKernelArguments &arguments, Statistics &stati
     const uint64_t timerResolution = levelzero.getTimerResolution(arguments.queuePlacement);
 
     // Create kernel
-    const auto kernelBinary = FileHelper::loadBinaryFile("multitile_memory_benchmark_copy_buffer.spv");
+    const auto kernelBinary = KernelRegistry::get("multitile_memory_benchmark_copy_buffer.spv");
     if (kernelBinary.size() == 0) {
         return TestResult::KernelNotFound;
     }
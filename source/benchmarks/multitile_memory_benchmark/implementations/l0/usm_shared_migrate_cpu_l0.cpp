@@ -8,7 +8,7 @@
 #include "framework/l0/levelzero.h"
 #include "framework/l0/utility/usm_helper.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/usm_shared_migrate_cpu.h"
@@ -33,7 +33,7 @@ static TestResult run(const UsmSharedMigrateCpuArguments &arguments, Statistics
     Timer timer;
 
     // Create kernel
-    const auto kernelBinary = FileHelper::loadBinaryFile("multitile_memory_benchmark_fill_with_ones.spv");
+    const auto kernelBinary = KernelRegistry::get("multitile_memory_benchmark_fill_with_ones.spv");
     if (kernelBinary.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -7,7 +7,7 @@
 
 #include "framework/l0/levelzero.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/usm_shared_migrate_cpu.h"
@@ -26,7 +26,7 @@ static TestResult run(const UsmSharedMigrateCpuArguments &arguments, Statistics
     Timer timer;
 
     // Create kernel
-    const auto kernelBinary = FileHelper::loadBinaryFile("memory_benchmark_fill_with_ones.spv");
+    const auto kernelBinary = KernelRegistry::get("memory_benchmark_fill_with_ones.spv");
     if (kernelBinary.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -9,7 +9,7 @@
 #include "framework/l0/utility/error.h"
 #include "framework/l0/utility/kernel_helper_l0.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/random_distribution.h"
 #include "framework/utility/timer.h"
 
@@ -277,7 +277,7 @@ struct RecordGraphConfig final {
         }
 
         // Create kernel
-        auto spirvModule = FileHelper::loadBinaryFile("graph_api_benchmark_kernel_assign.spv");
+        auto spirvModule = KernelRegistry::get("graph_api_benchmark_kernel_assign.spv");
         if (spirvModule.size() == 0) {
             this->status = RecordGraphConfigStatus::KernelNotFound;
             return;
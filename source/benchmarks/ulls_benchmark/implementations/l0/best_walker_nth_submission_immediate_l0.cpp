@@ -6,8 +6,9 @@
  */
 
 #include "framework/l0/levelzero.h"
+#include "framework/l0/utility/kernel_helper_l0.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/best_walker_nth_submission_immediate.h"
@@ -53,7 +54,7 @@ static TestResult run(const BestWalkerNthSubmissionImmediateArguments &arguments
     void *buffer = nullptr;
     volatile uint64_t *volatileBuffer = nullptr;
 
-    const auto kernelBinary = FileHelper::loadBinaryFile("ulls_benchmark_write_one.spv");
+    const auto kernelBinary = KernelRegistry::get("ulls_benchmark_write_one.spv");
     if (kernelBinary.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -77,7 +78,7 @@ static TestResult run(const BestWalkerNthSubmissionImmediateArguments &arguments
         volatileBuffer = static_cast<uint64_t *>(buffer);
 
         ze_module_handle_t module{};
-        ASSERT_ZE_RESULT_SUCCESS(zeModuleCreate(levelzero.context, levelzero.device, &moduleDesc, &module, nullptr));
+        ASSERT_ZE_RESULT_SUCCESS(L0::KernelHelper::createModule(levelzero, moduleDesc, &module));
         kernels[i].module = module;
 
         ze_kernel_handle_t kernel{};
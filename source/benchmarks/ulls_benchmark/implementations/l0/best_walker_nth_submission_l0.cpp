@@ -6,8 +6,9 @@
  */
 
 #include "framework/l0/levelzero.h"
+#include "framework/l0/utility/kernel_helper_l0.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/best_walker_nth_submission.h"
@@ -40,7 +41,7 @@ static TestResult run(const BestWalkerNthSubmissionArguments &arguments, Statist
 
     const ze_host_mem_alloc_desc_t allocationDesc{ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC, nullptr, ZE_HOST_MEM_ALLOC_FLAG_BIAS_UNCACHED};
 
-    const auto kernelBinary = FileHelper::loadBinaryFile("ulls_benchmark_write_one.spv");
+    const auto kernelBinary = KernelRegistry::get("ulls_benchmark_write_one.spv");
     if (kernelBinary.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -69,7 +70,7 @@ static TestResult run(const BestWalkerNthSubmissionArguments &arguments, Statist
         volatileBuffer = static_cast<uint64_t *>(buffer);
 
         ze_module_handle_t module{};
-        ASSERT_ZE_RESULT_SUCCESS(zeModuleCreate(levelzero.context, levelzero.device, &moduleDesc, &module, nullptr));
+        ASSERT_ZE_RESULT_SUCCESS(L0::KernelHelper::createModule(levelzero, moduleDesc, &module));
         kernels[i].module = module;
 
         ze_kernel_handle_t kernel{};
@@ -6,8 +6,9 @@
  */
 
 #include "framework/l0/levelzero.h"
+#include "framework/l0/utility/kernel_helper_l0.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/best_walker_submission_immediate.h"
@@ -47,7 +48,7 @@ static TestResult run(const BestWalkerSubmissionImmediateArguments &arguments, S
     volatile uint64_t *volatileBuffer = static_cast<uint64_t *>(buffer);
 
     // Create kernel
-    const auto kernelBinary = FileHelper::loadBinaryFile("ulls_benchmark_write_one.spv");
+    const auto kernelBinary = KernelRegistry::get("ulls_benchmark_write_one.spv");
     if (kernelBinary.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -56,7 +57,7 @@ static TestResult run(const BestWalkerSubmissionImmediateArguments &arguments, S
     moduleDesc.inputSize = kernelBinary.size();
     moduleDesc.pInputModule = kernelBinary.data();
     ze_module_handle_t module;
-    ASSERT_ZE_RESULT_SUCCESS(zeModuleCreate(levelzero.context, levelzero.device, &moduleDesc, &module, nullptr));
+    ASSERT_ZE_RESULT_SUCCESS(L0::KernelHelper::createModule(levelzero, moduleDesc, &module));
     ze_kernel_desc_t kernelDesc{ZE_STRUCTURE_TYPE_KERNEL_DESC};
     kernelDesc.flags = ZE_KERNEL_FLAG_EXPLICIT_RESIDENCY;
     kernelDesc.pKernelName = "write_one_uncached";
@@ -6,8 +6,9 @@
  */
 
 #include "framework/l0/levelzero.h"
+#include "framework/l0/utility/kernel_helper_l0.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/kernel_with_work_immediate.h"
@@ -36,7 +37,7 @@ static TestResult run(const KernelWithWorkImmediateArguments &arguments, Statist
     ASSERT_ZE_RESULT_SUCCESS(zeMemAllocDevice(levelzero.context, &deviceAllocationDesc, bufferSize, 0, levelzero.device, &buffer));
 
     // Create kernel
-    auto spirvModule = FileHelper::loadBinaryFile(selectKernel(arguments.usedIds, "spv"));
+    auto spirvModule = KernelRegistry::get(selectKernel(arguments.usedIds, "spv"));
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -46,7 +47,7 @@ static TestResult run(const KernelWithWorkImmediateArguments &arguments, Statist
     moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
     moduleDesc.pInputModule = reinterpret_cast<const uint8_t *>(spirvModule.data());
     moduleDesc.inputSize = spirvModule.size();
-    ASSERT_ZE_RESULT_SUCCESS(zeModuleCreate(levelzero.context, levelzero.device, &moduleDesc, &module, nullptr));
+    ASSERT_ZE_RESULT_SUCCESS(L0::KernelHelper::createModule(levelzero, moduleDesc, &module));
     ze_kernel_desc_t kernelDesc{ZE_STRUCTURE_TYPE_KERNEL_DESC};
     kernelDesc.pKernelName = "write_one";
     ASSERT_ZE_RESULT_SUCCESS(zeKernelCreate(module, &kernelDesc, &kernel));
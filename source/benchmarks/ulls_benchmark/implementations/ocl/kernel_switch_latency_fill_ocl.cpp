@@ -7,7 +7,7 @@
 
 #include "framework/ocl/opencl.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/kernel_switch_latency_fill.h"
@@ -34,7 +34,7 @@ static TestResult run(const KernelSwitchLatencyFillArguments &arguments, Statist
     const size_t lws = 256u;
 
     // Create kernel
-    const std::vector<uint8_t> kernelSource = FileHelper::loadTextFile("ulls_benchmark_fill_with_ones.cl");
+    const auto kernelSource = KernelRegistry::get("ulls_benchmark_fill_with_ones.cl");
     if (kernelSource.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -7,7 +7,7 @@
 
 #include "framework/ocl/opencl.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/kernel_switch_latency.h"
@@ -38,7 +38,7 @@ static TestResult run(const KernelSwitchLatencyArguments &arguments, Statistics
     const size_t lws = 64u;
 
     // Create kernel
-    const std::vector<uint8_t> kernelSource = FileHelper::loadTextFile("ulls_benchmark_eat_time.cl");
+    const auto kernelSource = KernelRegistry::get("ulls_benchmark_eat_time.cl");
     if (kernelSource.size() == 0) {
         return TestResult::KernelNotFound;
     }
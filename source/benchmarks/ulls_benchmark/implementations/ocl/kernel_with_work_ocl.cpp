@@ -7,7 +7,7 @@
 
 #include "framework/ocl/opencl.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/kernel_with_work.h"
@@ -34,7 +34,7 @@ static TestResult run(const KernelWithWorkArguments &arguments, Statistics &stat
     cl_mem buffer = clCreateBuffer(opencl.context, CL_MEM_READ_WRITE, bufferSize, nullptr, &retVal);
     ASSERT_CL_SUCCESS(retVal);
 
-    const std::vector<uint8_t> kernelSource = FileHelper::loadTextFile(selectKernel(arguments.usedIds, "cl"));
+    const auto kernelSource = KernelRegistry::get(selectKernel(arguments.usedIds, "cl"));
     if (kernelSource.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -8,7 +8,7 @@
 #include "framework/ocl/opencl.h"
 #include "framework/ocl/utility/queue_families_helper.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/sleep.h"
 #include "framework/utility/timer.h"
 
@@ -30,7 +30,7 @@ static TestResult run(const QueueConcurrencyArguments &arguments, Statistics &st
     Timer timer{};
     cl_int retVal{};
 
-    const std::vector<uint8_t> kernelSource = FileHelper::loadTextFile("ulls_benchmark_eat_time.cl");
+    const auto kernelSource = KernelRegistry::get("ulls_benchmark_eat_time.cl");
     if (kernelSource.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -8,7 +8,7 @@
 #include "framework/ocl/opencl.h"
 #include "framework/ocl/utility/queue_families_helper.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/queue_priorities.h"
@@ -36,7 +36,7 @@ static TestResult run(const QueuePrioritiesArguments &arguments, Statistics &sta
         return TestResult::DeviceNotCapable;
     }
 
-    const std::vector<uint8_t> kernelSource = FileHelper::loadTextFile("ulls_benchmark_eat_time.cl");
+    const auto kernelSource = KernelRegistry::get("ulls_benchmark_eat_time.cl");
     if (kernelSource.size() == 0) {
         return TestResult::KernelNotFound;
     }
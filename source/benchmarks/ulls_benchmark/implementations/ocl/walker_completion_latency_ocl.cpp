@@ -7,7 +7,7 @@
 
 #include "framework/ocl/opencl.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/walker_completion_latency.h"
@@ -40,7 +40,7 @@ static TestResult run(const WalkerCompletionLatencyArguments &arguments, Statist
     ASSERT_CL_SUCCESS(retVal);
 
     // Create kernel
-    const std::vector<uint8_t> kernelSource = FileHelper::loadTextFile("ulls_benchmark_write_one.cl");
+    const auto kernelSource = KernelRegistry::get("ulls_benchmark_write_one.cl");
     if (kernelSource.size() == 0) {
         return TestResult::KernelNotFound;
     }
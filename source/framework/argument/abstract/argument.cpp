@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,48 @@
 #include "framework/utility/command_line_argument.h"
 
 #include <iomanip>
+#include <iostream>
+#include <limits>
+
+namespace {
+// A range of more values is rather a typo than a sweep anybody waits for
+constexpr size_t maxRangeValues = 1024;
+
+bool expandRange(const std::string &range, size_t separatorPosition, Argument::RangeBoundParser parseRangeBound, std::vector<std::string> &outValues) {
+    const std::string from = range.substr(0, separatorPosition);
+    std::string to = range.substr(separatorPosition + 2);
+    std::string step = "+1";
+    if (const size_t stepPosition = to.find(':'); stepPosition != std::string::npos) {
+        step = to.substr(stepPosition + 1);
+        to = to.substr(0, stepPosition);
+    }
+
+    int64_t first{};
+    int64_t last{};
+    int64_t stepValue{};
+    if (step.size() < 2 || (step[0] != 'x' && step[0] != '+') ||
+        !parseRangeBound(from, first) || !parseRangeBound(to, last) || !parseRangeBound(step.substr(1), stepValue)) {
+        return false;
+    }
+    const bool geometric = step[0] == 'x';
+    if (first > last || (geometric && (first <= 0 || stepValue < 2)) || (!geometric && stepValue < 1)) {
+        return false;
+    }
+
+    const int64_t maxValueBeforeStep = geometric ? std::numeric_limits<int64_t>::max() / stepValue : std::numeric_limits<int64_t>::max() - stepValue;
+    for (int64_t value = first, count = 1; value <= last; value = geometric ? value * stepValue : value + stepValue, count++) {
+        if (count > static_cast<int64_t>(maxRangeValues)) {
+            std::cerr << "Range " << range << " has more than " << maxRangeValues << " values\n";
+            return false;
+        }
+        outValues.push_back(std::to_string(value));
+        if (value > maxValueBeforeStep) {
+            break;
+        }
+    }
+    return true;
+}
+} // namespace
 
 Argument::Argument(ArgumentContainer &parent, const std::string &key, const std::string &extraHelp)
     : key(key),
@@ -48,6 +90,11 @@ void Argument::parse(CommandLineArgument &argument) {
     }
 }
 
+bool Argument::getSweepValues(const std::string &value, std::vector<std::string> &outValues) const {
+    outValues = {value};
+    return true;
+}
+
 void Argument::markAsParsed() {
     this->parsed = true;
 }
@@ -55,3 +102,19 @@ void Argument::markAsParsed() {
 std::string Argument::getHelpEntry(const std::string &argumentKey) const {
     return std::string("--") + argumentKey + "=X ";
 }
+
+bool Argument::expandSweep(const std::string &value, RangeBoundParser parseRangeBound, std::vector<std::string> &outValues) {
+    outValues.clear();
+    std::istringstream items(value);
+    for (std::string item; std::getline(items, item, ',');) {
+        const size_t rangeSeparator = item.find("..");
+        if (item.empty()) {
+            return false;
+        } else if (rangeSeparator == std::string::npos || parseRangeBound == nullptr) {
+            outValues.push_back(item);
+        } else if (!expandRange(item, rangeSeparator, parseRangeBound, outValues)) {
+            return false;
+        }
+    }
+    return !outValues.empty() && value.back() != ',';
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,8 +9,10 @@
 
 #include "framework/utility/error.h"
 
+#include <cstdint>
 #include <sstream>
 #include <string>
+#include <vector>
 
 struct ArgumentContainer;
 class CommandLineArgument;
@@ -29,9 +31,19 @@ struct Argument {
         return result.str();
     }
 
+    std::string getValueString() const {
+        return toStringValue();
+    }
+
     void parse(CommandLineArgument &argument);
     void markAsParsed();
 
+    // Values swept in single-test mode, when the value is a list (a,b,c) or a range (from..to, from..to:xN
+    // or from..to:+N). Arguments, which cannot be swept, return the value unchanged. Returns false for a
+    // malformed sweep.
+    virtual bool getSweepValues(const std::string &value, std::vector<std::string> &outValues) const;
+    using RangeBoundParser = bool (*)(const std::string &value, int64_t &outValue);
+
     virtual bool validate() const {
         return true;
     }
@@ -45,6 +57,9 @@ struct Argument {
     virtual std::string toStringValue() const = 0;
     virtual std::string getHelpEntry(const std::string &key) const;
 
+    // Ranges are expanded only if parseRangeBound is given, list items are passed through unchanged otherwise
+    static bool expandSweep(const std::string &value, RangeBoundParser parseRangeBound, std::vector<std::string> &outValues);
+
   private:
     const std::string key;
     const std::string extraHelp;
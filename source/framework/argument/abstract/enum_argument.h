@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,6 +36,10 @@ struct EnumArgument : Argument {
         return false;
     }
 
+    bool getSweepValues(const std::string &valueToSweep, std::vector<std::string> &outValues) const override {
+        return expandSweep(valueToSweep, nullptr, outValues);
+    }
+
   protected:
     std::string toStringValue() const override {
         const auto valuesCount = sizeof(DerivedType::enumValues) / sizeof(DerivedType::enumValues[0]);
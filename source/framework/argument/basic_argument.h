@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,9 @@
 #include "framework/argument/abstract/argument.h"
 #include "framework/utility/string_utils.h"
 
+#include <cstdlib>
+#include <iostream>
+
 struct Unsigned32BitArgumentBase : Argument {
     using Argument::Argument;
 
@@ -44,6 +47,16 @@ struct IntegerArgumentBase : Argument {
         return &value;
     }
 
+    bool getSweepValues(const std::string &valueToSweep, std::vector<std::string> &outValues) const override {
+        return expandSweep(valueToSweep, parseInteger, outValues);
+    }
+
+    static bool parseInteger(const std::string &valueToParse, int64_t &outValue) {
+        char *end = nullptr;
+        outValue = std::strtoll(valueToParse.c_str(), &end, 10);
+        return !valueToParse.empty() && *end == '\0';
+    }
+
   protected:
     std::string toStringValue() const override {
         return std::to_string(this->value);
@@ -174,7 +187,17 @@ struct ByteSizeArgument : PositiveIntegerArgument {
         return std::to_string(currentValue) + units[currentUnit];
     }
 
+    bool getSweepValues(const std::string &valueToSweep, std::vector<std::string> &outValues) const override {
+        return expandSweep(valueToSweep, parseByteSize, outValues);
+    }
+
     void parseImpl(const std::string &valueToParse) override {
+        if (!parseByteSize(valueToParse, this->value)) {
+            std::cerr << "Invalid byte size argument value " << valueToParse << '\n';
+        }
+    }
+
+    static bool parseByteSize(const std::string &valueToParse, int64_t &outValue) {
         const std::string units[] = {"kb", "mb", "gb", "b", ""};
         const size_t unitMultipliers[] = {1024, 1024 * 1024, 1024 * 1024 * 1024, 1, 1};
         const auto unitCount = sizeof(units) / sizeof(units[0]);
@@ -196,13 +219,12 @@ struct ByteSizeArgument : PositiveIntegerArgument {
             }
         }
 
-        if (currentUnit >= unitCount) {
-            std::cerr << "Unknown byte size argument unit\n";
-            return;
+        if (currentUnit >= unitCount || !parseInteger(valueWithoutUnit, outValue)) {
+            return false;
         }
 
-        this->value = std::atol(valueWithoutUnit.c_str());
-        this->value *= unitMultipliers[currentUnit];
+        outValue *= unitMultipliers[currentUnit];
+        return true;
     }
 };
 
@@ -222,6 +244,10 @@ struct BooleanArgument : Argument {
         return *this;
     }
 
+    bool getSweepValues(const std::string &valueToSweep, std::vector<std::string> &outValues) const override {
+        return expandSweep(valueToSweep, nullptr, outValues);
+    }
+
     bool validate() const override {
         return value == 0 || value == 1;
     }
@@ -20,6 +20,6 @@ struct ProfilerTypeArgument : EnumArgument<ProfilerTypeArgument, ProfilerType> {
 
     static constexpr const char *enumName = "profiler selection";
     const static inline EnumType invalidEnumValue = EnumType::Unknown;
-    const static inline EnumType enumValues[2] = {EnumType::Timer, EnumType::CpuCounter};
-    static constexpr const char *enumValuesNames[2] = {"timer", "cpucounter"};
+    const static inline EnumType enumValues[4] = {EnumType::Timer, EnumType::CpuCounter, EnumType::Tsc, EnumType::CpuCounterGroup};
+    static constexpr const char *enumValuesNames[4] = {"timer", "cpucounter", "tsc", "cpucountergroup"};
 };
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/argument/abstract/argument.h"
+
+#include <cstdlib>
+#include <iostream>
+
+// Non-negative percentage with an optional '%' suffix, e.g. 1%, 0.5 or 2.5%.
+struct PercentageArgument : Argument {
+    using Argument::Argument;
+
+    operator double() const {
+        return value;
+    }
+
+    PercentageArgument &operator=(double newValue) {
+        this->value = newValue;
+        this->valid = true;
+        markAsParsed();
+        return *this;
+    }
+
+    bool validate() const override {
+        return valid;
+    }
+
+  protected:
+    std::string toStringValue() const override {
+        std::ostringstream result;
+        result << value << "%";
+        return result.str();
+    }
+
+    void parseImpl(const std::string &valueToParse) override {
+        std::string number = valueToParse;
+        if (!number.empty() && number.back() == '%') {
+            number.pop_back();
+        }
+
+        char *end = nullptr;
+        this->value = std::strtod(number.c_str(), &end);
+        this->valid = !number.empty() && *end == '\0' && this->value >= 0;
+        if (!this->valid) {
+            std::cerr << "Invalid percentage \"" << valueToParse << "\": expected a non-negative number, optionally followed by %\n";
+        }
+    }
+
+    double value = 0;
+    bool valid = true;
+};
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/argument/abstract/argument.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+// Comma-separated list of percentiles, e.g. 90,99,99.9. Each value must be in the (0, 100) range.
+struct PercentileListArgument : Argument {
+    using Argument::Argument;
+
+    operator const std::vector<double> &() const {
+        return get();
+    }
+
+    const std::vector<double> &get() const {
+        return value;
+    }
+
+    PercentileListArgument &operator=(const std::vector<double> &newValue) {
+        this->value = newValue;
+        this->valid = true;
+        markAsParsed();
+        return *this;
+    }
+
+    bool validate() const override {
+        return valid;
+    }
+
+    static std::string toPercentileString(double percentile) {
+        std::ostringstream result;
+        result << percentile;
+        return result.str();
+    }
+
+  protected:
+    std::string toStringValue() const override {
+        std::ostringstream result;
+        for (auto i = 0u; i < value.size(); i++) {
+            result << toPercentileString(value[i]);
+            if (i != value.size() - 1) {
+                result << ",";
+            }
+        }
+        return result.str();
+    }
+
+    void parseImpl(const std::string &valueToParse) override {
+        this->value.clear();
+        this->valid = true;
+        for (size_t tokenStart = 0u; tokenStart <= valueToParse.size();) {
+            const size_t commaPosition = valueToParse.find(',', tokenStart);
+            const std::string token = valueToParse.substr(tokenStart, commaPosition - tokenStart);
+
+            char *end = nullptr;
+            const double percentile = std::strtod(token.c_str(), &end);
+            if (token.empty() || *end != '\0' || !(percentile > 0) || !(percentile < 100)) {
+                std::cerr << "Invalid percentile \"" << token << "\": expected a number between 0 and 100 (exclusive)\n";
+                this->valid = false;
+                return;
+            }
+            this->value.push_back(percentile);
+
+            if (commaPosition == std::string::npos) {
+                break;
+            }
+            tokenStart = commaPosition + 1;
+        }
+    }
+
+    std::vector<double> value = {};
+    bool valid = true;
+};
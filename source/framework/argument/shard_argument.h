@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/argument/abstract/argument.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <iostream>
+
+// Part of the selected tests run by this process, either "i/N" for the i-th of N shards (0-based),
+// or "alone" for the tests which must not run in parallel with others. Not set by default.
+struct ShardArgument : Argument {
+    using Argument::Argument;
+
+    struct Shard {
+        size_t index = 0;
+        size_t count = 0;
+        bool alone = false;
+    };
+
+    operator const Shard &() const {
+        return value;
+    }
+
+    const Shard &get() const {
+        return value;
+    }
+
+    bool isSet() const {
+        return value.count > 0 || value.alone;
+    }
+
+    ShardArgument &operator=(const Shard &newValue) {
+        this->value = newValue;
+        this->valid = true;
+        markAsParsed();
+        return *this;
+    }
+
+    bool validate() const override {
+        return valid;
+    }
+
+  protected:
+    std::string toStringValue() const override {
+        if (value.alone) {
+            return "alone";
+        }
+        return std::to_string(value.index) + "/" + std::to_string(value.count);
+    }
+
+    void parseImpl(const std::string &valueToParse) override {
+        this->value = {};
+        if (valueToParse == "alone") {
+            this->value.alone = true;
+            this->valid = true;
+            return;
+        }
+        this->valid = parseIndexAndCount(valueToParse);
+        if (!this->valid) {
+            std::cerr << "Invalid shard \"" << valueToParse << "\": expected i/N with 0 <= i < N (e.g. 0/4), or alone\n";
+        }
+    }
+
+    bool parseIndexAndCount(const std::string &valueToParse) {
+        const size_t slash = valueToParse.find('/');
+        if (slash == std::string::npos || slash == 0 || slash + 1 == valueToParse.size()) {
+            return false;
+        }
+
+        errno = 0;
+        char *indexEnd = nullptr;
+        char *countEnd = nullptr;
+        const unsigned long long index = std::strtoull(valueToParse.c_str(), &indexEnd, 10);
+        const unsigned long long count = std::strtoull(valueToParse.c_str() + slash + 1, &countEnd, 10);
+        if (indexEnd != valueToParse.c_str() + slash || *countEnd != '\0' || errno == ERANGE || index >= count) {
+            return false;
+        }
+
+        value.index = static_cast<size_t>(index);
+        value.count = static_cast<size_t>(count);
+        return true;
+    }
+
+    Shard value = {};
+    bool valid = true;
+};
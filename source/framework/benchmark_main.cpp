@@ -11,16 +11,30 @@
 #include "framework/configuration.h"
 #include "framework/gtest_event_listener.h"
 #include "framework/print_device_info.h"
+#include "framework/test_case/baseline_comparison.h"
 #include "framework/test_case/test_case_statistics.h"
+#include "framework/test_case/test_isolation.h"
+#include "framework/test_case/test_shard.h"
 #include "framework/test_map.h"
 #include "framework/utility/common_help_message.h"
+#include "framework/utility/file_helper.h"
+#include "framework/utility/native_binary_cache.h"
+#include "framework/utility/process.h"
 #include "framework/utility/string_utils.h"
+#include "framework/utility/tsc_clock.h"
 #include "framework/utility/working_directory_helper.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstdio>
 #include <gtest/gtest.h>
+#include <iomanip>
 #include <iostream>
+#include <map>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <unordered_set>
 
 #ifdef _WIN32
 #ifndef WIN32_LEAN_AND_MEAN
@@ -78,6 +92,173 @@ bool pinToCpuMask(uint64_t mask, std::string &errorMessage) {
     return true;
 #endif
 }
+
+// Logical CPUs this process may run on, up to the ones CpuAffinityMaskArgument can address
+uint64_t getAvailableCpuMask() {
+#ifdef _WIN32
+    DWORD_PTR processMask = 0;
+    DWORD_PTR systemMask = 0;
+    if (GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask) == 0) {
+        return 0u;
+    }
+    return static_cast<uint64_t>(processMask);
+#else
+    cpu_set_t available;
+    CPU_ZERO(&available);
+    if (sched_getaffinity(0, sizeof(available), &available) != 0) {
+        return 0u;
+    }
+    uint64_t mask = 0u;
+    for (int cpu = 0; cpu < static_cast<int>(CpuAffinityMaskArgument::maxCpuCount); ++cpu) {
+        if (CPU_ISSET(cpu, &available)) {
+            mask |= 1ull << cpu;
+        }
+    }
+    return mask;
+#endif
+}
+
+// Splits CPUs of the mask into contiguous, disjoint parts, sized as evenly as possible. Neighbouring
+// CPUs usually share caches, so each part stays on as few of them as it can. Empty if there are
+// fewer CPUs than parts.
+std::vector<uint64_t> splitCpuMask(uint64_t mask, size_t partsCount) {
+    std::vector<int> cpus{};
+    for (int cpu = 0; cpu < static_cast<int>(CpuAffinityMaskArgument::maxCpuCount); ++cpu) {
+        if (mask & (1ull << cpu)) {
+            cpus.push_back(cpu);
+        }
+    }
+    if (cpus.size() < partsCount) {
+        return {};
+    }
+
+    std::vector<uint64_t> parts(partsCount, 0u);
+    size_t cpuIndex = 0;
+    for (size_t part = 0; part < partsCount; part++) {
+        const size_t cpuCount = cpus.size() / partsCount + (part < cpus.size() % partsCount ? 1 : 0);
+        for (size_t i = 0; i < cpuCount; i++) {
+            parts[part] |= 1ull << cpus[cpuIndex++];
+        }
+    }
+    return parts;
+}
+
+// Shard names contain a slash, which cannot be a part of a file name
+std::string getShardFileSuffix(std::string shard) {
+    std::replace(shard.begin(), shard.end(), '/', '-');
+    return "." + shard;
+}
+
+std::string toHexString(uint64_t value) {
+    std::ostringstream result;
+    result << "0x" << std::hex << value;
+    return result.str();
+}
+
+// Output of a worker started with --shardMarkers, split into lines printed before the first test,
+// lines of each test keyed by its number and lines printed after the last test, like the errors.
+// Transient lines, which a terminal overwrites after a carriage return, are left out.
+struct ShardOutput {
+    std::string preamble;
+    std::map<size_t, std::string> tests;
+    std::string trailer;
+};
+
+ShardOutput parseShardOutput(const std::string &output) {
+    const std::string testMarker = TestShard::testMarker;
+    ShardOutput result{};
+    std::string *current = &result.preamble;
+    std::istringstream stream(output);
+    std::string line;
+    while (std::getline(stream, line)) {
+        if (const size_t carriageReturn = line.find_last_of('\r'); carriageReturn != std::string::npos) {
+            line.erase(0, carriageReturn + 1);
+            if (line.find_first_not_of(' ') == std::string::npos) {
+                continue;
+            }
+        }
+
+        if (line.rfind(testMarker, 0) == 0) {
+            current = &result.tests[std::strtoull(line.c_str() + testMarker.size(), nullptr, 10)];
+        } else if (line == TestShard::endMarker) {
+            current = &result.trailer;
+        } else {
+            *current += line + '\n';
+        }
+    }
+    return result;
+}
+
+// Result lines of the workers carry the test name followed by TestShard::nameSeparator
+int getWidestShardedName(const std::string &lines) {
+    int maxNameWidth = 0;
+    std::istringstream stream(lines);
+    std::string line;
+    while (std::getline(stream, line)) {
+        if (const size_t separator = line.find(TestShard::nameSeparator); separator != std::string::npos) {
+            maxNameWidth = std::max(maxNameWidth, static_cast<int>(separator));
+        }
+    }
+    return maxNameWidth;
+}
+
+void printShardedLines(const std::string &lines, int nameColumnWidth) {
+    std::istringstream stream(lines);
+    std::string line;
+    while (std::getline(stream, line)) {
+        if (const size_t separator = line.find(TestShard::nameSeparator); separator != std::string::npos) {
+            std::cout << std::setw(nameColumnWidth) << std::left << line.substr(0, separator) << std::right << line.substr(separator + 1) << '\n';
+        } else {
+            std::cout << line << '\n';
+        }
+    }
+}
+
+// Records of JSON Lines files written by the workers are gathered in the requested file
+void mergeJsonOutputs(const std::string &filePath, const std::vector<std::string> &shards) {
+    bool created = false;
+    for (const std::string &shard : shards) {
+        const std::string shardFilePath = filePath + getShardFileSuffix(shard);
+        const std::vector<uint8_t> records = FileHelper::loadTextFile(shardFilePath);
+        if (records.empty()) {
+            continue;
+        }
+        const std::string_view text{reinterpret_cast<const char *>(records.data()), records.size()};
+        if (!FileHelper::appendToFile(filePath, text, !created)) {
+            std::cerr << "ERROR: cannot open JSON output file: " << filePath << '\n';
+            return;
+        }
+        created = true;
+        std::remove(shardFilePath.c_str());
+    }
+}
+
+// Splits a line of a plan on whitespace, double quotes keep whitespace within an argument
+std::vector<std::string> splitPlanLine(const std::string &line) {
+    std::vector<std::string> tokens{};
+    std::string token{};
+    bool inToken = false;
+    bool inQuotes = false;
+    for (const char character : line) {
+        if (character == '"') {
+            inQuotes = !inQuotes;
+            inToken = true;
+        } else if (!inQuotes && (character == ' ' || character == '\t')) {
+            if (inToken) {
+                tokens.push_back(std::move(token));
+                token.clear();
+                inToken = false;
+            }
+        } else {
+            token += character;
+            inToken = true;
+        }
+    }
+    if (inToken) {
+        tokens.push_back(std::move(token));
+    }
+    return tokens;
+}
 } // namespace
 
 int BenchmarkMain::printVersion(bool enableWarning, const char *prefix) {
@@ -191,6 +372,90 @@ int BenchmarkMain::executeSingleTest(const std::string &testName) {
     return 0;
 }
 
+int BenchmarkMain::executePlan(const std::string &planPath) {
+    const std::vector<uint8_t> planFile = FileHelper::loadTextFile(planPath);
+    if (planFile.empty()) {
+        std::cerr << "Plan " << planPath << " is empty or cannot be read\n";
+        return 1;
+    }
+
+    Configuration &configuration = Configuration::get();
+    const Api commandLineApi = configuration.selectedApi;
+    replaceGtestListener<SingleTestGtestListener>();
+    if (!configuration.noColumnNames && configuration.printType == Configuration::PrintType::Csv) {
+        TestCaseStatistics::printStatisticsHeader(configuration.printType, 0);
+    }
+
+    // A line which cannot be run is reported and skipped, the remaining lines still run
+    size_t failedLines = 0;
+    const auto reportFailedLine = [&](size_t lineNumber, const std::string &line, const std::string &reason) {
+        std::cerr << "ERROR: " << planPath << ':' << lineNumber << ": " << reason << ": " << line << '\n';
+        failedLines++;
+    };
+
+    std::istringstream planStream(std::string(planFile.begin(), planFile.end()));
+    std::string line;
+    for (size_t lineNumber = 1; std::getline(planStream, line); lineNumber++) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (const size_t firstCharacter = line.find_first_not_of(" \t"); firstCharacter == std::string::npos || line[firstCharacter] == '#') {
+            continue;
+        }
+
+        // Lines may be copied from a shell with the executable in front, everything before the first argument is skipped
+        std::vector<std::string> tokens = splitPlanLine(line);
+        tokens.erase(tokens.begin(), std::find_if(tokens.begin(), tokens.end(), [](const std::string &token) { return token.rfind("--", 0) == 0; }));
+        if (tokens.empty()) {
+            reportFailedLine(lineNumber, line, "no arguments");
+            continue;
+        }
+
+        // Parsed as a command line, which starts with the executable
+        std::vector<char *> lineArgv{argv[0]};
+        for (std::string &token : tokens) {
+            lineArgv.push_back(token.data());
+        }
+        CommandLineArguments lineArguments{};
+        std::string parsingErrors{};
+        if (!CommandLineArgument::parseArguments(static_cast<int>(lineArgv.size()), lineArgv.data(), lineArguments, parsingErrors)) {
+            reportFailedLine(lineNumber, line, parsingErrors);
+            continue;
+        }
+
+        std::string testName{};
+        configuration.selectedApi = commandLineApi;
+        for (CommandLineArgument &argument : lineArguments) {
+            if (argument.isKeyEqualTo("test")) {
+                testName = argument.getValue();
+                argument.markAsProcessed();
+            } else if (argument.isKeyEqualTo("api")) {
+                configuration.selectedApi.parse(argument);
+            }
+        }
+        if (configuration.selectedApi == Api::Unknown) {
+            reportFailedLine(lineNumber, line, "invalid --api");
+            continue;
+        }
+        const auto testCase = TestMap::get().find(testName);
+        if (testCase == TestMap::get().end()) {
+            reportFailedLine(lineNumber, line, testName.empty() ? "no --test given" : "unknown test case " + testName);
+            continue;
+        }
+        if (!testCase->second->runFromCommandLine(lineArguments)) {
+            reportFailedLine(lineNumber, line, "error parsing the line");
+        }
+    }
+    configuration.selectedApi = commandLineApi;
+    TestCaseStatistics::flushBufferedResults(configuration.printType);
+
+    if (failedLines > 0) {
+        std::cerr << failedLines << " lines of " << planPath << " could not be run\n";
+        return 1;
+    }
+    return 0;
+}
+
 int BenchmarkMain::executeAllTests() {
     for (auto &commandLineArgument : commandLineArguments) {
         if (commandLineArgument.getKey().find("gtest_") == 0) {
@@ -204,10 +469,124 @@ int BenchmarkMain::executeAllTests() {
         return 1;
     }
 
+    if (Configuration::get().jobs > 1) {
+        return executeAllTestsInWorkers();
+    }
+
+    if (Configuration::get().isolate) {
+        TestIsolation::setForwardedArguments(commandLineArguments);
+    }
     replaceGtestListener<AllTestsGtestListener>();
     return RUN_ALL_TESTS();
 }
 
+int BenchmarkMain::executeAllTestsInWorkers() {
+    const Configuration &configuration = Configuration::get();
+    const size_t jobs = configuration.jobs;
+    const std::vector<std::string> &deviceMasks = configuration.jobDeviceMasks;
+
+    // Workers are this benchmark started with the same arguments, except for the ones describing
+    // this process. Each of them prints only the results, the rest is printed here.
+    const std::unordered_set<std::string> argumentsNotForwarded = {
+        "jobs", "jobDeviceMasks", "cpuAffinityMask", "shardMarkers", "noHeaders", "noColumnNames", "noProgressBar", "jsonOutput"};
+    auto createWorker = [&](const std::string &shard, uint64_t cpuMask, const std::string &deviceMask) {
+        Process worker{WorkingDirectoryHelper::getExeLocation().string()};
+        worker.setSynchronizationArguments(false);
+        for (const CommandLineArgument &argument : commandLineArguments) {
+            if (argumentsNotForwarded.count(argument.getKey()) == 0) {
+                worker.addArgument(argument.getKey(), argument.getValue());
+            }
+        }
+        if (const std::string &jsonPath = configuration.jsonOutput; !jsonPath.empty()) {
+            worker.addArgument("jsonOutput", jsonPath + getShardFileSuffix(shard));
+        }
+        if (cpuMask != 0u) {
+            worker.addArgument("cpuAffinityMask", toHexString(cpuMask));
+        }
+        if (!deviceMask.empty()) {
+            worker.addEnvVariable("ZE_AFFINITY_MASK", deviceMask);
+        }
+        worker.addArgument("shard", shard);
+        worker.addArgument("shardMarkers", "");
+        worker.addArgument("noHeaders", "");
+        worker.addArgument("noColumnNames", "");
+        worker.addArgument("noProgressBar", "");
+        worker.setName("shard " + shard);
+        return worker;
+    };
+
+    // Pipes of the workers are drained while they run, so none of them blocks on a full one
+    std::vector<std::string> shards{};
+    std::vector<ShardOutput> outputs{};
+    int result = 0;
+    auto runWorkers = [&](std::vector<Process> &workers) {
+        std::vector<std::string> stdOuts(workers.size());
+        std::vector<std::thread> readers{};
+        for (size_t i = 0; i < workers.size(); i++) {
+            workers[i].run();
+            readers.emplace_back([&worker = workers[i], &stdOut = stdOuts[i]]() { stdOut = worker.getStdout(); });
+        }
+        for (size_t i = 0; i < workers.size(); i++) {
+            readers[i].join();
+            result = std::max(result, static_cast<int>(workers[i].getResult()));
+            outputs.push_back(parseShardOutput(stdOuts[i]));
+        }
+    };
+
+    const uint64_t availableCpus = configuration.cpuAffinityMask != 0u ? static_cast<uint64_t>(configuration.cpuAffinityMask) : getAvailableCpuMask();
+    const std::vector<uint64_t> cpuMasks = splitCpuMask(availableCpus, jobs);
+    if (cpuMasks.empty()) {
+        std::cerr << "WARNING: fewer CPUs available than --jobs, workers will not be pinned to separate CPUs\n";
+    }
+    std::vector<Process> workers{};
+    workers.reserve(jobs);
+    for (size_t job = 0; job < jobs; job++) {
+        shards.push_back(std::to_string(job) + "/" + std::to_string(jobs));
+        workers.push_back(createWorker(shards.back(), cpuMasks.empty() ? 0u : cpuMasks[job], deviceMasks.empty() ? "" : deviceMasks[job % deviceMasks.size()]));
+    }
+    runWorkers(workers);
+
+    // Tests which must not share the machine run afterwards, in one more worker with all the CPUs
+    const bool hasTestsToRunAlone = std::any_of(TestMap::get().begin(), TestMap::get().end(), [](const auto &entry) {
+        return entry.second->mustRunAlone() && !entry.second->getApisWithImplementation().empty();
+    });
+    if (hasTestsToRunAlone) {
+        shards.push_back("alone");
+        std::vector<Process> aloneWorker{};
+        aloneWorker.push_back(createWorker(shards.back(), configuration.cpuAffinityMask, deviceMasks.empty() ? "" : deviceMasks[0]));
+        runWorkers(aloneWorker);
+    }
+
+    if (const std::string &jsonPath = configuration.jsonOutput; !jsonPath.empty()) {
+        mergeJsonOutputs(jsonPath, shards);
+    }
+
+    // Merged in the order of a serial run
+    std::map<size_t, const std::string *> tests{};
+    for (const ShardOutput &output : outputs) {
+        std::cout << output.preamble;
+        for (const auto &[testIndex, lines] : output.tests) {
+            tests[testIndex] = &lines;
+        }
+    }
+    const bool hasResults = std::any_of(tests.begin(), tests.end(), [](const auto &test) { return !test.second->empty(); });
+    int nameColumnWidth = TestCaseStatistics::getMinNameColumnWidth();
+    for (const auto &test : tests) {
+        nameColumnWidth = std::max(nameColumnWidth, getWidestShardedName(*test.second));
+    }
+    if (!configuration.noColumnNames && (hasResults || configuration.printType == Configuration::PrintType::Csv)) {
+        TestCaseStatistics::printStatisticsHeader(configuration.printType, nameColumnWidth);
+    }
+    for (const auto &test : tests) {
+        printShardedLines(*test.second, nameColumnWidth);
+    }
+    for (const ShardOutput &output : outputs) {
+        std::cout << output.trailer;
+    }
+    std::cout.flush();
+    return result;
+}
+
 void BenchmarkMain::printHelp() {
     const auto filename = BenchmarkInfo::get().getBenchmarkFilename();
     // clang-format off
@@ -222,7 +601,8 @@ void BenchmarkMain::printHelp() {
                  "\n"
                  "Second mode runs one specific benchmark with custom parameter values. Running benchmarks in this fashion requires "
                  "using --test argument, along with benchmark-specific parameters. All parameters have to be specified, there are no "
-                 "default values.\n"
+                 "default values. Numeric, boolean and enum parameters can be given as a list (--wgs=32,64,256) or a range "
+                 "(--size=4KB..1GB:x2 or --wgc=1..64:+8) of values; every combination of them is run and reported as a separate row.\n"
                  "\n"
                  "Example invocations:\n"
                  "\t" << filename << "                                                runs all possible tests\n"
@@ -256,7 +636,7 @@ void BenchmarkMain::printHelp() {
 }
 
 int BenchmarkMain::setupEnvironment() {
-    // Kernels will be loaded from the CWD, so we need to ensure we're in the right directory.
+    // Workloads are started from the CWD, so we need to ensure we're in the right directory.
     WorkingDirectoryHelper::changeDirectoryToExeDirectory();
 
     // Each command line argument must be parsed and validated.
@@ -273,6 +653,13 @@ int BenchmarkMain::setupEnvironment() {
         return 1;
     }
 
+    // Baseline is loaded upfront, so a wrong path is reported before running any test
+    if (const std::string &baseline = Configuration::get().baseline; !baseline.empty()) {
+        if (!BaselineComparison::load(baseline)) {
+            return 1;
+        }
+    }
+
     // Opt-in CPU pinning (a zero mask leaves affinity untouched).
     if (const uint64_t mask = Configuration::get().cpuAffinityMask; mask != 0u) {
         std::string errorMessage{};
@@ -327,11 +714,33 @@ int BenchmarkMain::main() {
         std::cout << deviceInfoStr;
         TestCaseStatistics::setDeviceInfo(deviceInfoStr);
         printVersion(false, "Benchmark version: ");
+        if (Configuration::get().profilerType == ProfilerType::Tsc) {
+            std::cout << TscClock::getDescription() << '\n';
+        }
+    } else if (!static_cast<const std::string &>(Configuration::get().jsonOutput).empty()) {
+        // JSON records carry the device info even if it is not printed
+        TestCaseStatistics::setDeviceInfo(DeviceInfo::getDeviceInfoString());
+    }
+    if (Configuration::get().profilerType == ProfilerType::Tsc) {
+        // Calibrated before any test runs, even if not printed, so it does not end up in a measurement
+        TscClock::getCalibration();
     }
     ::testing::InitGoogleTest(&argc, argv);
-    if (std::string test = configuration.test; test != "") {
-        return executeSingleTest(test);
+    int result = 0;
+    if (const std::string &plan = configuration.plan; !plan.empty()) {
+        result = executePlan(plan);
+    } else if (std::string test = configuration.test; test != "") {
+        result = executeSingleTest(test);
     } else {
-        return executeAllTests();
+        result = executeAllTests();
+    }
+    if (NativeBinaryCache::isEnabled() && !configuration.noHeaders && configuration.printType != Configuration::PrintType::Csv) {
+        std::cout << NativeBinaryCache::renderReport();
+    }
+
+    if (result == 0 && BaselineComparison::wasRegressionFound()) {
+        std::cerr << "Regressions against the baseline were found\n";
+        return 2;
     }
+    return result;
 }
@@ -30,5 +30,7 @@ class BenchmarkMain {
     int listTestSuites();
 
     int executeSingleTest(const std::string &testName);
+    int executePlan(const std::string &planPath);
     int executeAllTests();
+    int executeAllTestsInWorkers();
 };
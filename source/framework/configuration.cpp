@@ -8,6 +8,7 @@
 #include "framework/configuration.h"
 
 #include "framework/benchmark_info.h"
+#include "framework/utility/cpu_counter.h"
 
 std::unique_ptr<Configuration> Configuration::instance = {};
 
@@ -25,15 +26,35 @@ Configuration::Configuration()
       urPlatformIndex(*this, "urPlatformIndex", "UR adapter index"),
       urDeviceIndex(*this, "urDeviceIndex", "UR device index inside the adapter"),
       test(*this, "test", "Selects particular test for execution. All arguments of the test must be provided"),
+      plan(*this, "plan", "run the single-test command lines of the given file, one per line, in this process, e.g. \"--test=UsmCopy --api=l0 --size=4KB ...\". Results of all lines are printed as one table and gathered in one set of output files. Arguments of the whole run, e.g. --iterations or --csv, are taken from the command line, lines may only select the test, its arguments and --api. Tokens before the first -- argument, e.g. the executable, are ignored, as are empty lines and lines starting with #. Cannot be used with --test, --jobs, --shard and --isolate"),
+      autotune(*this, "autotune", "in single-test mode, search the values of the given arguments, separated by spaces or commas, for the best result instead of running every combination of them, e.g. --autotune=\"lws vectorSize\" --lws=32..1024:x2 --vectorSize=1,2,4,8. All arguments given lists or ranges of values must be tuned. Each argument in turn is set to all its values with the others fixed at the best configuration so far, until nothing improves or --autotuneBudget configurations were measured. Time is minimized, bandwidth and FLOPS are maximized. The best configuration and all the explored ones are printed at the end. Implies --moduleCache"),
+      autotuneBudget(*this, "autotuneBudget", "maximum number of configurations measured by --autotune"),
       subDeviceSelection(*this, "subDeviceSelection", "Device to be used in the benchmarks. Might be ignored by some specific tests"),
       csv(*this, "csv", "dump results in CSV format for easy imports to spreadsheets"),
       verbose(*this, "verbose", "dump results from all iterations"),
       interactivePrints(*this, "interactivePrints", "display test name before running it. May cause unexcpected results when redirecting output to files."),
       iterations(*this, "iterations", "select how many times each test will be run"),
+      targetRelativeError(*this, "targetRelativeError", "run each test until the 95% confidence interval of the median is within given relative error (e.g. 1%), instead of a fixed number of --iterations. 0 (default) disables this mode"),
+      minIterations(*this, "minIterations", "minimum number of iterations of each test when --targetRelativeError is used"),
+      maxIterations(*this, "maxIterations", "maximum number of iterations of each test when --targetRelativeError is used"),
       warmupIterations(*this, "warmupIterations", "select how many warmup iterations will be run before actual test iterations"),
+      autoWarmup(*this, "autoWarmup", "after --warmupIterations, also discard the samples of each metric until the median of a sliding window settles at the median of the second half of the run. At most half of the samples are discarded. The count is printed in an extra column. Cannot be used with --streamingStatistics"),
       trimOutliers(*this, "trimOutliers", "percentage of samples to trim from each end before computing statistics (0-49)"),
+      streamingStatistics(*this, "streamingStatistics", "keep a fixed-size histogram of each metric instead of every sample, so memory does not grow with --iterations. Quantiles (e.g. median) are then accurate to 0.5%. Cannot be used with --verbose"),
+      percentiles(*this, "percentiles", "comma-separated list of percentiles to print as additional result columns, e.g. 90,99,99.9"),
       sleepFor(*this, "sleepFor", "sleep for specified amount of time after running each test, in milliseconds"),
       cpuAffinityMask(*this, "cpuAffinityMask", "pin the benchmark to the given logical CPUs (up to 64, bit i = CPU i), either as a bitmask - decimal or 0x-prefixed hex (e.g. 5 or 0x5 = CPU0+CPU2) - or as a CPU list (e.g. 0,2,4-7); threads and child processes inherit the mask; 0 (default) leaves CPU affinity untouched, so use 1 to pin to CPU0 alone"),
+      shard(*this, "shard", "run only a part of the selected tests, i/N for the i-th of N shards (0-based), dealt round-robin in the order of a serial run; tests which must not run in parallel with others are left out and run with --shard=alone"),
+      jobs(*this, "jobs", "run all-tests mode in the given number of worker processes, each running one --shard, followed by one running the tests which must run alone. Workers are pinned to disjoint parts of the available CPUs and their results are printed in the order of a serial run. Records of --jsonOutput are gathered in the given file, the other file outputs cannot be used with it. 0 or 1 runs tests in this process"),
+      jobDeviceMasks(*this, "jobDeviceMasks", "space separated ZE_AFFINITY_MASK values given to the --jobs workers in turn, e.g. \"0.0 0.1 1\", so each of them uses its own device or tile"),
+      shardMarkers(*this, "shardMarkers", "precede output of each test with a marker line, used by --jobs to merge outputs of --shard workers"),
+      isolate(*this, "isolate", "run each test of all-tests mode in a separate process, so a crash or a hang of one test is reported as its ERROR and the remaining tests still run. Adds the cost of starting the process and the driver to each test, not to its measurements. Cannot be used with --timelineOutput and --traceOutput"),
+      timeout(*this, "timeout", "with --isolate, kill a test still running after the given number of seconds and report it as an ERROR. 0 (default) waits without a limit"),
+      isolatedTest(*this, "isolatedTest", "print results of a single test as in all-tests mode, used by --isolate to merge outputs of the processes running the tests"),
+      reuseRuntime(*this, "reuseRuntime", "keep the driver, the default context and the default queue of LevelZero and OpenCL between tests, keyed by the properties they were created with, instead of creating them for every test. Shortens all-tests runs, but results of tests sensitive to the state of the context may differ. Tests requiring a fresh context still get one"),
+      moduleCache(*this, "moduleCache", "keep native binaries of kernels built by the framework's kernel helpers, keyed by their SPIR-V or source, the device and the build options, and create modules and programs from them instead of compiling the same kernel again. Hits, misses and the compile time saved are printed at the end of the run. Implied by --autotune"),
+      moduleCacheDir(*this, "moduleCacheDir", "also keep the binaries of --moduleCache in files of the given directory, created if missing, for later runs and other processes. Implies --moduleCache"),
+      kernelDir(*this, "kernelDir", "use kernel files found in the given directory instead of the kernels built into the benchmark, e.g. source/kernels of the repository, so kernels can be changed without rebuilding. A relative path starts in the directory of the executable"),
       selectedApi(*this, "api", "Compute API to be used"),
       noIntelExtensions(*this, "no-intel-extensions", "do not run benchmark requiring Intel specific extensions"),
       dumpCommandLines(*this, "dumpCommandLines", "output commandline arguments to run the each test"),
@@ -44,6 +65,12 @@ Configuration::Configuration()
       noProgressBar(*this, "noProgressBar", "Do not show the progress bar during benchmark execution"),
       htmlOutput(*this, "htmlOutput", "Write results to an HTML file at the given path"),
       mdOutput(*this, "mdOutput", "Write results to a Markdown file at the given path"),
+      jsonOutput(*this, "jsonOutput", "Write results to a JSON Lines file at the given path, one object per test as soon as it finishes"),
+      jsonRawSamples(*this, "jsonRawSamples", "Include all samples of every metric in --jsonOutput records. Ignored with --streamingStatistics"),
+      timelineOutput(*this, "timelineOutput", "Write every sample with its iteration index and steady clock timestamp in nanoseconds to a CSV file at the given path, appended after each test finishes"),
+      traceOutput(*this, "traceOutput", "Write spans measured by CPU timers and counters, with thread id, test name and iteration, as Chrome trace event JSON to the given path, which can be loaded in Perfetto. Appended after each test finishes"),
+      baseline(*this, "baseline", "Compare results with a --jsonOutput file of an earlier run, written with --jsonRawSamples. Adds delta, p-value (Mann-Whitney U test) and verdict columns. Exit code is 2 if any regression is found"),
+      regressionThreshold(*this, "regressionThreshold", "minimum significant change of the median to be reported as a regression or an improvement with --baseline (e.g. 5%)"),
       doNotPrintBandwidth(*this, "doNotPrintBandwidth", "Make every results that are normally in [GB/s] to be printed in [us]"),
       dumpErrorsImmediately(*this, "dumpErrorsImmediately", "print errors to stdout immediately after they happen, not at the end of the run"),
       argFilter(*this, "argFilter", "filter tests by their arguments"),
@@ -51,9 +78,17 @@ Configuration::Configuration()
       returnSubmissionTimeInsteadOfWorkloadTime(*this, "forceSubmissionProfiling", "Overrides profiling to return submission time instead of workload time"),
       markTimers(*this, "markTimers", "Provides prints around Timer Start & End"),
       measurePower(*this, "measurePower", "Measures power and energy in supported benchmarks"),
+      measureCpuTime(*this, "measureCpuTime", "Adds cpu utilization to every test - CPU time of the whole process divided by wall time. It is measured for each iteration of benchmarks which mark their iterations, the first one also covering the test's setup, and for the whole test of the others"),
+      measureHostPower(*this, "measureHostPower", "Adds host package and core energy [uJ] and average package power [W] from RAPL (/sys/class/powercap), and effective CPU frequency [GHz] of the process from APERF/MPERF, to every test - one value measured over the whole test, setup included. Missing sources are skipped with a warning"),
       printAllResults(*this, "printAllResults", "Prints all test results"),
-      printHistogram(*this, "printHistogram", "Prints a histogram of the result distribution across all iterations for each benchmark (default/verbose output only; ignored for --csv and --noop)"),
-      profilerType(*this, "profilerType", "If supported by the benchmark, dictates the profiler/statistic used/reported by the benchmark"),
+      printHistogram(*this, "printHistogram", "Prints a histogram of the result distribution across all iterations for each benchmark (default/verbose output only; ignored for --csv, --noop and --streamingStatistics)"),
+      apiCallStatistics(*this, "apiCallStatistics", "Count calls and measure latency of every API call checked by the result macros, e.g. ASSERT_ZE_RESULT_SUCCESS, and print the given number of functions with the highest total time after each test (default/verbose output only). Timing the calls perturbs the results of the run. 0 disables it"),
+      monitorOsNoise(*this, "monitorOsNoise", "Counts context switches, CPU migrations and page faults of the measuring thread around each CPU timer measurement and reports them, together with host interrupts, after each test (default/verbose output only; Linux only). Iterations with an involuntary switch or a migration are counted as preempted"),
+      dropPreemptedSamples(*this, "dropPreemptedSamples", "Leaves results of iterations preempted by the OS out of the statistics, at most half of them. Only benchmarks which mark their iterations are affected. Implies --monitorOsNoise"),
+      profilerType(*this, "profilerType", "If supported by the benchmark, dictates the profiler/statistic used/reported by the benchmark. tsc applies to all benchmarks, it makes the CPU timer read the x86 time stamp counter, which costs a few nanoseconds instead of tens"),
+      subtractTimerOverhead(*this, "subtractTimerOverhead", "Subtract the cost of an empty measurement, calibrated at startup, from each result of --profilerType=tsc"),
+      cpuCounterEvents(*this, "cpuCounterEvents", "Space separated events counted together with --profilerType=cpucountergroup: cycles, instructions, llc-misses, branch-misses, dtlb-misses, page-faults, context-switches. All of them by default. IPC is reported when both cycles and instructions are counted"),
+      cpuCounterInherit(*this, "cpuCounterInherit", "CPU counters also count threads created by the measuring thread after the counters were opened"),
       extended(*this, "extended", "Run the benchmark with extended parameters"),
       reducedSizeCAL(*this, "reducedSizeCAL", "Run benchmark with lower buffer size"),
       additionalConfiguration(*this) {
@@ -81,14 +116,32 @@ Configuration::Configuration()
 
     // Api agnostic params
     test = "";
+    plan = "";
+    autotune = std::vector<std::string>();
+    autotuneBudget = 32;
     csv = false;
     verbose = false;
     interactivePrints = false;
     warmupIterations = 1;
+    autoWarmup = false;
     trimOutliers = 0;
+    streamingStatistics = false;
+    percentiles = std::vector<double>();
     iterations = 10;
+    targetRelativeError = 0;
+    minIterations = 10;
+    maxIterations = 1000;
     sleepFor = 20;
     cpuAffinityMask = 0;
+    shard = ShardArgument::Shard{};
+    jobs = 0;
+    jobDeviceMasks = std::vector<std::string>();
+    isolate = false;
+    timeout = 0;
+    reuseRuntime = false;
+    moduleCache = false;
+    moduleCacheDir = "";
+    kernelDir = "";
     selectedApi = Api::All;
     noIntelExtensions = false;
     dumpCommandLines = false;
@@ -100,12 +153,22 @@ Configuration::Configuration()
     noProgressBar = false;
     htmlOutput = "";
     mdOutput = "";
+    jsonOutput = "";
+    jsonRawSamples = false;
+    timelineOutput = "";
+    traceOutput = "";
+    baseline = "";
+    regressionThreshold = 5;
     doNotPrintBandwidth = false;
     dumpErrorsImmediately = false;
     argFilter = std::vector<std::string>();
     testFilter = std::vector<std::string>();
     returnSubmissionTimeInsteadOfWorkloadTime = false;
+    apiCallStatistics = 0;
     profilerType = ProfilerType::Timer;
+    subtractTimerOverhead = false;
+    cpuCounterEvents = std::vector<std::string>();
+    cpuCounterInherit = false;
 
     // Test specific params
     extended = false;
@@ -155,5 +218,51 @@ bool Configuration::validateArgumentsExtra() const {
     if (trimOutliers >= 50) {
         return false;
     }
+    if (streamingStatistics && verbose) {
+        return false;
+    }
+    if (streamingStatistics && autoWarmup) {
+        return false;
+    }
+    if (minIterations > maxIterations) {
+        return false;
+    }
+    if (subtractTimerOverhead && profilerType != ProfilerType::Tsc) {
+        return false;
+    }
+    if (jobs > 1 && shard.isSet()) {
+        return false;
+    }
+    if (jobs > 1) {
+        // Only JSON Lines records of the workers are merged
+        for (const StringArgument *fileOutput : {&htmlOutput, &mdOutput, &timelineOutput, &traceOutput}) {
+            if (!static_cast<const std::string &>(*fileOutput).empty()) {
+                return false;
+            }
+        }
+    }
+    if (timeout > 0 && !isolate) {
+        return false;
+    }
+    if (!static_cast<const std::string &>(plan).empty() && (!static_cast<const std::string &>(test).empty() || jobs > 1 || shard.isSet() || isolate)) {
+        return false;
+    }
+    if (!autotune.get().empty() && static_cast<const std::string &>(test).empty() && static_cast<const std::string &>(plan).empty()) {
+        return false;
+    }
+    if (isolate) {
+        // Processes running the tests would overwrite each other's files
+        for (const StringArgument *fileOutput : {&timelineOutput, &traceOutput}) {
+            if (!static_cast<const std::string &>(*fileOutput).empty()) {
+                return false;
+            }
+        }
+    }
+    for (const std::string &event : cpuCounterEvents.get()) {
+        CpuCounterEvent parsedEvent{};
+        if (!parseCpuCounterEvent(event, parsedEvent)) {
+            return false;
+        }
+    }
     return true;
 }
@@ -14,6 +14,9 @@
 #include "framework/argument/enum/api_argument.h"
 #include "framework/argument/enum/device_selection_argument.h"
 #include "framework/argument/enum/profiler_type_argument.h"
+#include "framework/argument/percentage_argument.h"
+#include "framework/argument/percentile_list_argument.h"
+#include "framework/argument/shard_argument.h"
 #include "framework/argument/string_argument.h"
 #include "framework/argument/string_list_argument.h"
 #include "framework/utility/command_line_argument.h"
@@ -64,15 +67,35 @@ struct Configuration : ArgumentContainer {
 
     // Api agnostic params
     StringArgument test;
+    StringArgument plan;
+    StringListArgument autotune;
+    PositiveIntegerArgument autotuneBudget;
     DeviceSelectionArgument subDeviceSelection;
     BooleanFlagArgument csv;
     BooleanFlagArgument verbose;
     BooleanFlagArgument interactivePrints;
     PositiveIntegerArgument iterations;
+    PercentageArgument targetRelativeError;
+    PositiveIntegerArgument minIterations;
+    PositiveIntegerArgument maxIterations;
     NonNegativeIntegerArgument warmupIterations;
+    BooleanFlagArgument autoWarmup;
     NonNegativeIntegerArgument trimOutliers;
+    BooleanFlagArgument streamingStatistics;
+    PercentileListArgument percentiles;
     IntegerArgument sleepFor;
     CpuAffinityMaskArgument cpuAffinityMask;
+    ShardArgument shard;
+    NonNegativeIntegerArgument jobs;
+    StringListArgument jobDeviceMasks;
+    BooleanFlagArgument shardMarkers;
+    BooleanFlagArgument isolate;
+    NonNegativeIntegerArgument timeout;
+    BooleanFlagArgument isolatedTest;
+    BooleanFlagArgument reuseRuntime;
+    BooleanFlagArgument moduleCache;
+    StringArgument moduleCacheDir;
+    StringArgument kernelDir;
     ApiArgument selectedApi;
     BooleanFlagArgument noIntelExtensions;
     BooleanFlagArgument dumpCommandLines;
@@ -83,6 +106,12 @@ struct Configuration : ArgumentContainer {
     BooleanFlagArgument noProgressBar;
     StringArgument htmlOutput;
     StringArgument mdOutput;
+    StringArgument jsonOutput;
+    BooleanFlagArgument jsonRawSamples;
+    StringArgument timelineOutput;
+    StringArgument traceOutput;
+    StringArgument baseline;
+    PercentageArgument regressionThreshold;
     BooleanFlagArgument doNotPrintBandwidth;
     BooleanArgument dumpErrorsImmediately;
     StringListArgument argFilter;
@@ -90,9 +119,17 @@ struct Configuration : ArgumentContainer {
     BooleanFlagArgument returnSubmissionTimeInsteadOfWorkloadTime;
     BooleanFlagArgument markTimers;
     BooleanFlagArgument measurePower;
+    BooleanFlagArgument measureCpuTime;
+    BooleanFlagArgument measureHostPower;
     BooleanFlagArgument printAllResults;
     BooleanFlagArgument printHistogram;
+    NonNegativeIntegerArgument apiCallStatistics;
+    BooleanFlagArgument monitorOsNoise;
+    BooleanFlagArgument dropPreemptedSamples;
     ProfilerTypeArgument profilerType;
+    BooleanFlagArgument subtractTimerOverhead;
+    StringListArgument cpuCounterEvents;
+    BooleanFlagArgument cpuCounterInherit;
 
     // Test specific params
     BooleanFlagArgument extended;
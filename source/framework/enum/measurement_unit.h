@@ -21,7 +21,9 @@ enum class MeasurementUnit {
     Percentage,
     MicroJoules,
     Watts,
-    CpuHardwareCounter
+    CpuHardwareCounter,
+    Ratio,
+    Gigahertz
 };
 
 namespace std {
@@ -45,6 +47,10 @@ inline std::string to_string(MeasurementUnit unit) {
         return "[W]";
     case MeasurementUnit::CpuHardwareCounter:
         return "[count]";
+    case MeasurementUnit::Ratio:
+        return "[ratio]";
+    case MeasurementUnit::Gigahertz:
+        return "[GHz]";
     default:
         FATAL_ERROR("Unknown measurement unit");
     }
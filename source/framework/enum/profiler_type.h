@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2025 Intel Corporation
+ * Copyright (C) 2025-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,8 @@
 /// Defines the type of profiler used.
 enum class ProfilerType {
     Unknown,
-    Timer,      /// Timer class, representing wall time
-    CpuCounter, /// CpuCounter class, representing CPU instructions retired
+    Timer,           /// Timer class, representing wall time
+    CpuCounter,      /// CpuCounter class, representing CPU instructions retired
+    Tsc,             /// Timer class reading the time stamp counter, representing wall time
+    CpuCounterGroup, /// CpuCounterGroup class, representing events selected with --cpuCounterEvents
 };
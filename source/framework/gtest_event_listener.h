@@ -9,6 +9,7 @@
 
 #include "framework/configuration.h"
 #include "framework/test_case/test_case_statistics.h"
+#include "framework/test_case/test_shard.h"
 
 #include <algorithm>
 #include <gtest/gtest.h>
@@ -74,11 +75,17 @@ class AllTestsGtestListener : public ::testing::EmptyTestEventListener {
     void OnTestProgramStart(const ::testing::UnitTest &unitTest) override {
         totalTests = unitTest.total_test_count();
         if (!Configuration::get().noHeaders && Configuration::get().printType != Configuration::PrintType::Csv) {
-            std::cout << "Running " << Configuration::get().iterations << " iterations of each benchmark\n\n";
+            if (Configuration::get().targetRelativeError > 0) {
+                std::cout << "Running " << Configuration::get().minIterations << " to " << Configuration::get().maxIterations
+                          << " iterations of each benchmark, until the median is within " << Configuration::get().targetRelativeError
+                          << "% (95% confidence)\n\n";
+            } else {
+                std::cout << "Running " << Configuration::get().iterations << " iterations of each benchmark\n\n";
+            }
         }
         // For CSV, print the header immediately (no alignment needed).
-        // For fixed-width modes, the header is deferred to OnTestProgramEnd so the
-        // TestCase column width can be sized to the longest name seen across all tests.
+        // For fixed-width modes, the header is printed with the first result, its TestCase column
+        // sized to the longest name among the results held back until then.
         if (!Configuration::get().noColumnNames && Configuration::get().printType == Configuration::PrintType::Csv) {
             TestCaseStatistics::printStatisticsHeader(Configuration::get().printType, 0);
         }
@@ -87,6 +94,7 @@ class AllTestsGtestListener : public ::testing::EmptyTestEventListener {
     void OnTestProgramEnd([[maybe_unused]] const ::testing::UnitTest &unitTest) override {
         clearProgress();
         TestCaseStatistics::flushBufferedResults(Configuration::get().printType);
+        TestShard::printEndMarker();
         dumpErrors();
     }
 
@@ -101,6 +109,8 @@ class AllTestsGtestListener : public ::testing::EmptyTestEventListener {
     }
     void OnTestEnd(const ::testing::TestInfo &testCase) override {
         completedTests++;
+        clearProgress();
+        TestCaseStatistics::flushCompletedResults(Configuration::get().printType);
         printProgress();
         if (testCase.result()->Failed()) {
             currentTestCaseErrorInfo.name << testCase.test_case_name() << "." << testCase.name();
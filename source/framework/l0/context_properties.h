@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,6 +16,7 @@ struct ContextProperties {
     bool requireCreationSuccess = true;
     bool createContext = true;
     bool fakeSubDeviceAllowed = false;
+    bool freshContext = false;
 
     static ContextProperties create() {
         return ContextProperties()
@@ -41,5 +42,12 @@ struct ContextProperties {
         requireCreationSuccess = false;
         return *this;
     }
+
+    // The context and the queue are not taken from the ones kept between tests with --reuseRuntime,
+    // for tests which leave state in them or measure their first use
+    ContextProperties &requireFreshContext() {
+        freshContext = true;
+        return *this;
+    }
 };
 } // namespace L0
@@ -9,31 +9,55 @@
 
 #include "framework/l0/utility/queue_families_helper.h"
 
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <sstream>
+
 namespace L0 {
+namespace {
+// Objects kept between tests with --reuseRuntime. They are never destroyed, the driver releases
+// them when the process exits.
+struct ReusedRuntime {
+    ze_context_handle_t context{};
+    QueueFamiliesHelper::QueueDesc queueDesc{};
+    bool inUse = false;
+};
+struct ReusedDevices {
+    ze_driver_handle_t driver{};
+    std::vector<ze_device_handle_t> rootDevices{};
+};
+std::mutex reusedRuntimesMutex{};
+std::map<std::string, ReusedRuntime> reusedRuntimes{};
+std::unique_ptr<ReusedDevices> reusedDevices{};
+
+std::string getReusedRuntimeKey(const QueueProperties &queueProperties, const ContextProperties &contextProperties) {
+    std::ostringstream key{};
+    key << static_cast<int>(contextProperties.deviceSelection) << ' ' << contextProperties.createContext << ' '
+        << contextProperties.requireCreationSuccess << ' ' << contextProperties.fakeSubDeviceAllowed << ' '
+        << queueProperties.createQueue << ' ' << queueProperties.requireCreationSuccess << ' '
+        << static_cast<int>(queueProperties.selectedEngine) << ' ' << static_cast<int>(queueProperties.deviceSelection) << ' '
+        << static_cast<int>(queueProperties.priority);
+    return key.str();
+}
+} // namespace
+
 LevelZero::LevelZero(const QueueProperties &queueProperties, const ContextProperties &contextProperties,
                      const ExtensionProperties &extensionProperties)
     : driverIndex(Configuration::get().l0DriverIndex),
       rootDeviceIndex(Configuration::get().l0DeviceIndex) {
-    EXPECT_ZE_RESULT_SUCCESS(zeInit(ZE_INIT_FLAG_GPU_ONLY));
-
-    // Get driver
-    uint32_t driverCount = 0;
-    EXPECT_ZE_RESULT_SUCCESS(zeDriverGet(&driverCount, nullptr));
-    if (driverIndex >= driverCount) {
-        FATAL_ERROR("Invalid LevelZero driver index. driverIndex=", driverIndex, " driverCount=", driverCount);
-    }
-    auto drivers = std::make_unique<ze_driver_handle_t[]>(driverCount);
-    EXPECT_ZE_RESULT_SUCCESS(zeDriverGet(&driverCount, drivers.get()));
-    this->driver = drivers[driverIndex];
-
-    // Create root device
-    uint32_t deviceCount = 0;
-    EXPECT_ZE_RESULT_SUCCESS(zeDeviceGet(driver, &deviceCount, nullptr));
-    if (rootDeviceIndex >= deviceCount) {
-        FATAL_ERROR("Invalid LevelZero device index. deviceIndex=", rootDeviceIndex, " deviceCount=", deviceCount);
+    const bool reuseRuntime = Configuration::get().reuseRuntime && !contextProperties.freshContext;
+    if (reuseRuntime) {
+        std::lock_guard<std::mutex> lock{reusedRuntimesMutex};
+        if (reusedDevices == nullptr) {
+            discoverDevices();
+            reusedDevices = std::make_unique<ReusedDevices>(ReusedDevices{this->driver, this->rootDevices});
+        }
+        this->driver = reusedDevices->driver;
+        this->rootDevices = reusedDevices->rootDevices;
+    } else {
+        discoverDevices();
     }
-    rootDevices.resize(deviceCount);
-    EXPECT_ZE_RESULT_SUCCESS(zeDeviceGet(driver, &deviceCount, rootDevices.data()));
     this->rootDevice = rootDevices[rootDeviceIndex];
 
     // Create subDevices if needed
@@ -55,14 +79,41 @@ LevelZero::LevelZero(const QueueProperties &queueProperties, const ContextProper
     DEVELOPER_WARNING_IF(!isCounterBasedEventsSupported(), "Counter-based events require L0 API version >= 1.15");
 
     initializeExtension(extensionProperties);
-    // Create context on the default device
-    this->context = createContext(contextProperties);
-    if (this->context == nullptr) {
-        return;
+
+    // Take the context and the queue kept by an earlier object, unless another one uses them now
+    QueueFamiliesHelper::QueueDesc queueDesc{};
+    const std::string key = reuseRuntime ? getReusedRuntimeKey(queueProperties, contextProperties) : "";
+    if (reuseRuntime) {
+        std::lock_guard<std::mutex> lock{reusedRuntimesMutex};
+        if (auto it = reusedRuntimes.find(key); it != reusedRuntimes.end() && !it->second.inUse) {
+            it->second.inUse = true;
+            this->reusedRuntimeKey = key;
+            this->context = it->second.context;
+            queueDesc = it->second.queueDesc;
+        }
+    }
+
+    if (this->reusedRuntimeKey.empty()) {
+        // Create context on the default device
+        this->context = createContext(contextProperties);
+        if (this->context == nullptr) {
+            return;
+        }
+
+        // Create queue
+        queueDesc = createQueue(queueProperties);
+
+        // Kept for objects created later, if there is none kept for them yet
+        if (reuseRuntime) {
+            std::lock_guard<std::mutex> lock{reusedRuntimesMutex};
+            if (reusedRuntimes.count(key) == 0) {
+                reusedRuntimes[key] = ReusedRuntime{this->context, queueDesc, true};
+                this->reusedRuntimeKey = key;
+                this->commandQueues.erase(std::remove(this->commandQueues.begin(), this->commandQueues.end(), queueDesc.queue), this->commandQueues.end());
+            }
+        }
     }
 
-    // Create queue
-    QueueFamiliesHelper::QueueDesc queueDesc = createQueue(queueProperties);
     this->commandQueue = queueDesc.queue;
     this->commandQueueDesc = queueDesc.desc;
     this->commandQueueDevice = queueDesc.family.device;
@@ -73,11 +124,37 @@ LevelZero::~LevelZero() noexcept(false) {
     for (auto &queue : commandQueues) {
         EXPECT_ZE_RESULT_SUCCESS(zeCommandQueueDestroy(queue));
     }
-    if (context != nullptr) {
+    if (!reusedRuntimeKey.empty()) {
+        std::lock_guard<std::mutex> lock{reusedRuntimesMutex};
+        reusedRuntimes[reusedRuntimeKey].inUse = false;
+    } else if (context != nullptr) {
         EXPECT_ZE_RESULT_SUCCESS(zeContextDestroy(context));
     }
 }
 
+void LevelZero::discoverDevices() {
+    EXPECT_ZE_RESULT_SUCCESS(zeInit(ZE_INIT_FLAG_GPU_ONLY));
+
+    // Get driver
+    uint32_t driverCount = 0;
+    EXPECT_ZE_RESULT_SUCCESS(zeDriverGet(&driverCount, nullptr));
+    if (driverIndex >= driverCount) {
+        FATAL_ERROR("Invalid LevelZero driver index. driverIndex=", driverIndex, " driverCount=", driverCount);
+    }
+    auto drivers = std::make_unique<ze_driver_handle_t[]>(driverCount);
+    EXPECT_ZE_RESULT_SUCCESS(zeDriverGet(&driverCount, drivers.get()));
+    this->driver = drivers[driverIndex];
+
+    // Create root device
+    uint32_t deviceCount = 0;
+    EXPECT_ZE_RESULT_SUCCESS(zeDeviceGet(driver, &deviceCount, nullptr));
+    if (rootDeviceIndex >= deviceCount) {
+        FATAL_ERROR("Invalid LevelZero device index. deviceIndex=", rootDeviceIndex, " deviceCount=", deviceCount);
+    }
+    rootDevices.resize(deviceCount);
+    EXPECT_ZE_RESULT_SUCCESS(zeDeviceGet(driver, &deviceCount, rootDevices.data()));
+}
+
 ze_device_handle_t LevelZero::getDevice(DeviceSelection deviceSelection) const {
     FATAL_ERROR_IF(DeviceSelectionHelper::hasHost(deviceSelection), "Cannot get ze_device_handle_t for host");
     FATAL_ERROR_UNLESS(DeviceSelectionHelper::hasSingleDevice(deviceSelection), "Cannot get multiple devices");
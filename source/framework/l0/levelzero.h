@@ -45,6 +45,10 @@ struct GraphExtension {
 // and queues. It is configurable by the QueueProperties and ContextProperties objects, allowing to perform the
 // setup in a different way than usual. Default constructor always creates both the context and the queue.
 //
+// With --reuseRuntime the driver, the context and the default queue are kept between tests and
+// shared by LevelZero objects created with the same properties, one object at a time. Additional
+// queues are always created for the object.
+//
 // LevelZero performs it's own cleanup.
 struct LevelZero {
     // Public fields, accessible in benchmarks
@@ -244,7 +248,10 @@ struct LevelZero {
     std::vector<ze_device_handle_t> rootDevices{};
 
   private:
+    void discoverDevices();
+
     // Internal fields managed by the LevelZero class
+    std::string reusedRuntimeKey{}; // set if the context and the default queue are kept after this object
     ze_device_handle_t rootDevice{};
     std::vector<ze_device_handle_t> subDevices{};
     std::vector<ze_command_queue_handle_t> commandQueues{};
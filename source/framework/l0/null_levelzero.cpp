@@ -11,6 +11,8 @@
 #include "level_zero/zex_event.h"
 #include "levelzero.h"
 
+#include <algorithm>
+
 #define FAIL_NOT_IMPLEMENTED                                             \
     std::cerr << __func__ << " not implemented in null_levelzero.cpp\n"; \
     abort();
@@ -288,7 +290,14 @@ ZE_MOCK_SUCCESS(zeModuleDestroy, ze_module_handle_t)
 ZE_MOCK_SUCCESS(zeModuleDynamicLink, uint32_t, ze_module_handle_t *, ze_module_build_log_handle_t *)
 ZE_MOCK_SUCCESS(zeModuleBuildLogDestroy, ze_module_build_log_handle_t)
 ZE_MOCK_SUCCESS(zeModuleBuildLogGetString, ze_module_build_log_handle_t, size_t *, char *)
-ZE_MOCK_SUCCESS(zeModuleGetNativeBinary, ze_module_handle_t, size_t *, uint8_t *)
+ZE_APIEXPORT ze_result_t ZE_APICALL zeModuleGetNativeBinary(ze_module_handle_t hModule, size_t *pSize, uint8_t *pModuleNativeBinary) {
+    (void)hModule;
+    *pSize = 16;
+    if (pModuleNativeBinary != nullptr) {
+        std::fill_n(pModuleNativeBinary, *pSize, uint8_t{0xCD});
+    }
+    return ZE_RESULT_SUCCESS;
+}
 ZE_MOCK_SUCCESS(zeModuleGetGlobalPointer, ze_module_handle_t, const char *, size_t *, void **)
 ZE_MOCK_SUCCESS(zeModuleGetKernelNames, ze_module_handle_t, uint32_t *, const char **)
 ZE_MOCK_SUCCESS(zeModuleGetProperties, ze_module_handle_t, ze_module_properties_t *)
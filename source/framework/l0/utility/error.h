@@ -8,13 +8,16 @@
 #pragma once
 
 #include "framework/l0/utility/error_codes.h"
+#include "framework/utility/api_call_statistics.h"
 #include "framework/utility/error.h"
 
 #include <string>
 
 #define ASSERT_ZE_RESULT_SUCCESS(retVal)                                                                                                       \
     {                                                                                                                                          \
+        API_CALL_STATISTICS_BEGIN(#retVal)                                                                                                     \
         const ze_result_t tempVarForDefine = (retVal);                                                                                         \
+        API_CALL_STATISTICS_END(#retVal)                                                                                                       \
         if (tempVarForDefine != ZE_RESULT_SUCCESS) {                                                                                           \
             NON_FATAL_ERROR("ASSERT_ZE_RESULT_SUCCESS", #retVal, std::to_string(tempVarForDefine).c_str(), l0ErrorToString(tempVarForDefine)); \
             return TestResult::Error;                                                                                                          \
@@ -23,7 +26,9 @@
 
 #define EXPECT_ZE_RESULT_SUCCESS(retVal)                                                                                                       \
     {                                                                                                                                          \
+        API_CALL_STATISTICS_BEGIN(#retVal)                                                                                                     \
         const ze_result_t tempVarForDefine = (retVal);                                                                                         \
+        API_CALL_STATISTICS_END(#retVal)                                                                                                       \
         if (tempVarForDefine != ZE_RESULT_SUCCESS) {                                                                                           \
             NON_FATAL_ERROR("EXPECT_ZE_RESULT_SUCCESS", #retVal, std::to_string(tempVarForDefine).c_str(), l0ErrorToString(tempVarForDefine)); \
         }                                                                                                                                      \
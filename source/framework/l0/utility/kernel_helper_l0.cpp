@@ -7,12 +7,75 @@
 
 #include "kernel_helper_l0.h"
 
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
+#include "framework/utility/native_binary_cache.h"
+
+#include <chrono>
+#include <iomanip>
+#include <sstream>
 
 namespace L0::KernelHelper {
+namespace {
+// Binaries are shared by devices of the same type, but not across drivers
+std::string getDeviceKey(LevelZero &levelzero, ze_module_format_t format) {
+    const ze_device_properties_t deviceProperties = levelzero.getDeviceProperties();
+    ze_driver_properties_t driverProperties{ZE_STRUCTURE_TYPE_DRIVER_PROPERTIES};
+    EXPECT_ZE_RESULT_SUCCESS(zeDriverGetProperties(levelzero.driver, &driverProperties));
+
+    std::ostringstream key;
+    key << std::hex << deviceProperties.vendorId << ':' << deviceProperties.deviceId << ':' << deviceProperties.name << ':';
+    for (const uint8_t byte : driverProperties.uuid.id) {
+        key << std::setw(2) << std::setfill('0') << static_cast<uint32_t>(byte);
+    }
+    key << ':' << driverProperties.driverVersion << ':' << static_cast<uint32_t>(format);
+    return key.str();
+}
+} // namespace
+
+ze_result_t createModule(LevelZero &levelzero, const ze_module_desc_t &moduleDesc, ze_module_handle_t *module, ze_module_build_log_handle_t *buildLog) {
+    // Values of specialization constants are not part of the key
+    const bool hasConstants = moduleDesc.pConstants != nullptr && moduleDesc.pConstants->numConstants > 0;
+    if (!NativeBinaryCache::isEnabled() || moduleDesc.format == ZE_MODULE_FORMAT_NATIVE || hasConstants || levelzero.device == nullptr) {
+        return zeModuleCreate(levelzero.context, levelzero.device, &moduleDesc, module, buildLog);
+    }
+
+    const std::string key = NativeBinaryCache::getKey(moduleDesc.pInputModule, moduleDesc.inputSize, getDeviceKey(levelzero, moduleDesc.format), moduleDesc.pBuildFlags);
+    if (const NativeBinaryCache::Binary binary = NativeBinaryCache::find(key)) {
+        ze_module_desc_t nativeDesc = moduleDesc;
+        nativeDesc.format = ZE_MODULE_FORMAT_NATIVE;
+        nativeDesc.pInputModule = binary->data();
+        nativeDesc.inputSize = binary->size();
+        if (zeModuleCreate(levelzero.context, levelzero.device, &nativeDesc, module, buildLog) == ZE_RESULT_SUCCESS) {
+            NativeBinaryCache::recordHit(key);
+            return ZE_RESULT_SUCCESS;
+        }
+        if (buildLog != nullptr && *buildLog != nullptr) {
+            zeModuleBuildLogDestroy(*buildLog);
+        }
+    }
+
+    const auto compileStart = std::chrono::steady_clock::now();
+    const ze_result_t result = zeModuleCreate(levelzero.context, levelzero.device, &moduleDesc, module, buildLog);
+    const auto compileTime = std::chrono::steady_clock::now() - compileStart;
+    if (result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
+
+    size_t binarySize = 0;
+    std::vector<uint8_t> binary;
+    if (zeModuleGetNativeBinary(*module, &binarySize, nullptr) == ZE_RESULT_SUCCESS && binarySize > 0) {
+        binary.resize(binarySize);
+        if (zeModuleGetNativeBinary(*module, &binarySize, binary.data()) != ZE_RESULT_SUCCESS) {
+            binary.clear();
+        }
+    }
+    NativeBinaryCache::recordMiss(key, std::move(binary), std::chrono::duration_cast<std::chrono::nanoseconds>(compileTime));
+    return result;
+}
+
 TestResult loadKernel(LevelZero &levelzero, const std::string &filePath, const std::string &kernelName, ze_kernel_handle_t *kernel,
                       ze_module_handle_t *module, const char *pBuildFlags) {
-    auto sourceFile = FileHelper::loadTextFile(filePath);
+    auto sourceFile = KernelRegistry::get(filePath);
     if (sourceFile.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -22,7 +85,7 @@ TestResult loadKernel(LevelZero &levelzero, const std::string &filePath, const s
     moduleDesc.pInputModule = reinterpret_cast<const uint8_t *>(sourceFile.data());
     moduleDesc.inputSize = sourceFile.size();
     moduleDesc.pBuildFlags = pBuildFlags;
-    auto status = zeModuleCreate(levelzero.context, levelzero.device, &moduleDesc, module, nullptr);
+    auto status = createModule(levelzero, moduleDesc, module);
 
     if (status != ZE_RESULT_SUCCESS) {
         ze_module_build_log_handle_t buildLog;
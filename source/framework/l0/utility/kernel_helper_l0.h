@@ -12,6 +12,10 @@
 
 #include <level_zero/ze_api.h>
 namespace L0::KernelHelper {
+// zeModuleCreate on the default device, with --moduleCache creating the module from the native binary
+// of an earlier build of the same input with the same build flags instead of compiling it again
+ze_result_t createModule(LevelZero &levelzero, const ze_module_desc_t &moduleDesc, ze_module_handle_t *module,
+                         ze_module_build_log_handle_t *buildLog = nullptr);
 TestResult loadKernel(LevelZero &levelzero, const std::string &filePath, const std::string &kernelName, ze_kernel_handle_t *kernel,
                       ze_module_handle_t *module, const char *pBuildFlags);
-}
\ No newline at end of file
+} // namespace L0::KernelHelper
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,7 @@ struct ContextProperties {
     DeviceSelection deviceSelection = DeviceSelection::Unknown;
     bool createContext = true;
     bool requireCreationSuccess = true;
+    bool freshContext = false;
 
     static ContextProperties create() {
         return ContextProperties()
@@ -35,5 +36,12 @@ struct ContextProperties {
         requireCreationSuccess = false;
         return *this;
     }
+
+    // The context and the queue are not taken from the ones kept between tests with --reuseRuntime,
+    // for tests which leave state in them or measure their first use
+    ContextProperties &requireFreshContext() {
+        freshContext = true;
+        return *this;
+    }
 };
 } // namespace OCL
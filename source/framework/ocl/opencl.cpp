@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2025 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,47 +7,66 @@
 
 #include "opencl.h"
 
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <sstream>
+
 namespace OCL {
+namespace {
+// Objects kept between tests with --reuseRuntime. They are never released, the driver releases
+// them when the process exits.
+struct ReusedRuntime {
+    cl_context context{};
+    cl_command_queue commandQueue{};
+    bool inUse = false;
+};
+struct ReusedDevices {
+    cl_platform_id platform{};
+    cl_device_id rootDevice{};
+    std::vector<cl_device_id> subDevices{};
+};
+std::mutex reusedRuntimesMutex{};
+std::map<std::string, ReusedRuntime> reusedRuntimes{};
+std::unique_ptr<ReusedDevices> reusedDevices{};
+
+std::string getReusedRuntimeKey(const QueueProperties &queueProperties, const ContextProperties &contextProperties) {
+    std::ostringstream key{};
+    key << static_cast<int>(contextProperties.deviceSelection) << ' ' << contextProperties.createContext << ' '
+        << contextProperties.requireCreationSuccess << ' '
+        << queueProperties.createQueue << ' ' << queueProperties.requireCreationSuccess << ' ' << queueProperties.profiling << ' '
+        << static_cast<int>(queueProperties.selectedEngine) << ' ' << queueProperties.ooq << ' ' << static_cast<int>(queueProperties.deviceSelection);
+    return key.str();
+}
+} // namespace
 
 Opencl::Opencl(const QueueProperties &queueProperties, const ContextProperties &contextProperties) {
-    // Get Platform
-    cl_uint numPlatforms;
-    EXPECT_CL_SUCCESS(clGetPlatformIDs(0, nullptr, &numPlatforms));
-
-    auto platforms = std::make_unique<cl_platform_id[]>(numPlatforms);
-    EXPECT_CL_SUCCESS(clGetPlatformIDs(numPlatforms, platforms.get(), nullptr));
-
-    auto platformIndex = Configuration::get().oclPlatformIndex;
-    cl_uint numDevices;
-
-    if (platformIndex == -1) {
-        for (uint32_t localPlatformIndex = 0u; localPlatformIndex < numPlatforms; localPlatformIndex++) {
-            if (clGetDeviceIDs(platforms[localPlatformIndex], CL_DEVICE_TYPE_GPU, 0, nullptr, &numDevices) == CL_SUCCESS) {
-                platformIndex = localPlatformIndex;
-                break;
-            }
+    const bool reuseRuntime = Configuration::get().reuseRuntime && !contextProperties.freshContext;
+    if (reuseRuntime) {
+        std::lock_guard<std::mutex> lock{reusedRuntimesMutex};
+        if (reusedDevices == nullptr) {
+            discoverDevices();
+            reusedDevices = std::make_unique<ReusedDevices>(ReusedDevices{this->platform, this->rootDevice, {}});
         }
+        this->platform = reusedDevices->platform;
+        this->rootDevice = reusedDevices->rootDevice;
+    } else {
+        discoverDevices();
     }
 
-    if (platformIndex >= numPlatforms) {
-        FATAL_ERROR("Invalid OCL platform index. platformIndex=", platformIndex, " numPlatforms=", numPlatforms);
-    }
-
-    this->platform = platforms[platformIndex];
-
-    // Create root device
-    EXPECT_CL_SUCCESS(clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, 0, nullptr, &numDevices));
-    const auto deviceIndex = Configuration::get().oclDeviceIndex;
-    if (deviceIndex >= numDevices) {
-        FATAL_ERROR("Invalid OCL device index. deviceIndex=", deviceIndex, " numDevices=", numDevices);
-    }
-    auto devices = std::make_unique<cl_device_id[]>(numDevices);
-    EXPECT_CL_SUCCESS(clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, numDevices, devices.get(), nullptr));
-    this->rootDevice = devices[deviceIndex];
-
     // Create sub devices if needed
     if (DeviceSelectionHelper::hasAnySubDevice(contextProperties.deviceSelection)) {
-        this->createSubDevices(contextProperties.requireCreationSuccess);
+        if (reuseRuntime) {
+            std::lock_guard<std::mutex> lock{reusedRuntimesMutex};
+            if (reusedDevices->subDevices.empty()) {
+                this->createSubDevices(contextProperties.requireCreationSuccess);
+                reusedDevices->subDevices = this->subDevices;
+            }
+            this->subDevices = reusedDevices->subDevices;
+            this->subDevicesReused = true;
+        } else {
+            this->createSubDevices(contextProperties.requireCreationSuccess);
+        }
         const auto requiredSubDevicesCount = DeviceSelectionHelper::getMaxSubDeviceIndex(contextProperties.deviceSelection) + 1;
         if (this->subDevices.size() < requiredSubDevicesCount) {
             return;
@@ -59,6 +78,19 @@ Opencl::Opencl(const QueueProperties &queueProperties, const ContextProperties &
         this->device = getDevice(contextProperties.deviceSelection);
     }
 
+    // Take the context and the queue kept by an earlier object, unless another one uses them now
+    const std::string key = reuseRuntime ? getReusedRuntimeKey(queueProperties, contextProperties) : "";
+    if (reuseRuntime) {
+        std::lock_guard<std::mutex> lock{reusedRuntimesMutex};
+        if (auto it = reusedRuntimes.find(key); it != reusedRuntimes.end() && !it->second.inUse) {
+            it->second.inUse = true;
+            this->reusedRuntimeKey = key;
+            this->context = it->second.context;
+            this->commandQueue = it->second.commandQueue;
+            return;
+        }
+    }
+
     // Create context on the default device
     this->context = createContext(contextProperties);
     if (this->context == nullptr) {
@@ -67,6 +99,17 @@ Opencl::Opencl(const QueueProperties &queueProperties, const ContextProperties &
 
     // Create command queue on the default device
     this->commandQueue = createQueue(queueProperties);
+
+    // Kept for objects created later, if there is none kept for them yet
+    if (reuseRuntime) {
+        std::lock_guard<std::mutex> lock{reusedRuntimesMutex};
+        if (reusedRuntimes.count(key) == 0) {
+            reusedRuntimes[key] = ReusedRuntime{this->context, this->commandQueue, true};
+            this->reusedRuntimeKey = key;
+            this->contexts.erase(std::remove(this->contexts.begin(), this->contexts.end(), this->context), this->contexts.end());
+            this->commandQueues.erase(std::remove(this->commandQueues.begin(), this->commandQueues.end(), this->commandQueue), this->commandQueues.end());
+        }
+    }
 }
 
 Opencl::~Opencl() noexcept(false) {
@@ -76,11 +119,55 @@ Opencl::~Opencl() noexcept(false) {
     for (auto &contextToRelease : contexts) {
         EXPECT_CL_SUCCESS(clReleaseContext(contextToRelease));
     }
+    if (!reusedRuntimeKey.empty()) {
+        std::lock_guard<std::mutex> lock{reusedRuntimesMutex};
+        reusedRuntimes[reusedRuntimeKey].inUse = false;
+    }
+    if (subDevicesReused) {
+        return;
+    }
     for (auto &subDeviceToRelease : subDevices) {
         EXPECT_CL_SUCCESS(clReleaseDevice(subDeviceToRelease));
     }
 }
 
+void Opencl::discoverDevices() {
+    // Get Platform
+    cl_uint numPlatforms;
+    EXPECT_CL_SUCCESS(clGetPlatformIDs(0, nullptr, &numPlatforms));
+
+    auto platforms = std::make_unique<cl_platform_id[]>(numPlatforms);
+    EXPECT_CL_SUCCESS(clGetPlatformIDs(numPlatforms, platforms.get(), nullptr));
+
+    auto platformIndex = Configuration::get().oclPlatformIndex;
+    cl_uint numDevices;
+
+    if (platformIndex == -1) {
+        for (uint32_t localPlatformIndex = 0u; localPlatformIndex < numPlatforms; localPlatformIndex++) {
+            if (clGetDeviceIDs(platforms[localPlatformIndex], CL_DEVICE_TYPE_GPU, 0, nullptr, &numDevices) == CL_SUCCESS) {
+                platformIndex = localPlatformIndex;
+                break;
+            }
+        }
+    }
+
+    if (platformIndex >= numPlatforms) {
+        FATAL_ERROR("Invalid OCL platform index. platformIndex=", platformIndex, " numPlatforms=", numPlatforms);
+    }
+
+    this->platform = platforms[platformIndex];
+
+    // Create root device
+    EXPECT_CL_SUCCESS(clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, 0, nullptr, &numDevices));
+    const auto deviceIndex = Configuration::get().oclDeviceIndex;
+    if (deviceIndex >= numDevices) {
+        FATAL_ERROR("Invalid OCL device index. deviceIndex=", deviceIndex, " numDevices=", numDevices);
+    }
+    auto devices = std::make_unique<cl_device_id[]>(numDevices);
+    EXPECT_CL_SUCCESS(clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, numDevices, devices.get(), nullptr));
+    this->rootDevice = devices[deviceIndex];
+}
+
 cl_command_queue Opencl::createQueue(QueueProperties queueProperties) {
     if (!queueProperties.createQueue) {
         return nullptr;
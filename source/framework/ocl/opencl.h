@@ -20,6 +20,10 @@ namespace OCL {
 // and queues. It is configurable by the QueueProperties and ContextProperties objects, allowing to perform the
 // setup in a different way than usual. Default constructor always creates both the context and the queue.
 //
+// With --reuseRuntime the platform, the devices, the context and the default queue are kept between
+// tests and shared by Opencl objects created with the same properties, one object at a time.
+// Additional contexts and queues are always created for the object.
+//
 // Opencl performs it's own cleanup.
 struct Opencl {
     // Public fields, accessible in benchmarks
@@ -53,8 +57,11 @@ struct Opencl {
     // Queriers subDevices of the root device and creates them if any. This method is only called when
     // it's necessary, i.e. user specified some subDevices in ContextProperties.
     bool createSubDevices(bool requireSuccess);
+    void discoverDevices();
 
     // Internal fields managed by the Opencl class
+    std::string reusedRuntimeKey{}; // set if the context and the default queue are kept after this object
+    bool subDevicesReused = false;
     cl_device_id rootDevice;
     std::vector<cl_device_id> subDevices{};
     std::vector<cl_context> contexts{};
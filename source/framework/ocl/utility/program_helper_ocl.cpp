@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,17 +8,73 @@
 #include "program_helper_ocl.h"
 
 #include "framework/ocl/utility/error.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
+#include "framework/utility/native_binary_cache.h"
 #include "framework/utility/string_utils.h"
 
+#include <chrono>
+#include <sstream>
+
+namespace {
+// Binaries are shared by devices of the same name, but not across drivers
+std::string getDeviceKey(cl_device_id device) {
+    std::ostringstream key;
+    for (const cl_device_info info : {CL_DEVICE_VENDOR_ID, CL_DEVICE_NAME, CL_DRIVER_VERSION}) {
+        size_t size{};
+        clGetDeviceInfo(device, info, 0, nullptr, &size);
+        std::string value(size, '\0');
+        clGetDeviceInfo(device, info, size, value.data(), nullptr);
+        key << value << ':';
+    }
+    return key.str();
+}
+
+bool buildProgramFromCachedBinary(cl_context context, cl_device_id device, const std::string &cacheKey, const char *compileOptions, cl_program &outProgram) {
+    const NativeBinaryCache::Binary binary = NativeBinaryCache::find(cacheKey);
+    if (binary == nullptr) {
+        return false;
+    }
+
+    const unsigned char *binaries[] = {binary->data()};
+    const size_t binarySize = binary->size();
+    cl_int binaryStatus{};
+    cl_int retVal{};
+    cl_program program = clCreateProgramWithBinary(context, 1, &device, &binarySize, binaries, &binaryStatus, &retVal);
+    if (retVal != CL_SUCCESS || binaryStatus != CL_SUCCESS) {
+        if (program != nullptr) {
+            clReleaseProgram(program);
+        }
+        return false;
+    }
+    if (clBuildProgram(program, 1, &device, compileOptions, nullptr, nullptr) != CL_SUCCESS) {
+        clReleaseProgram(program);
+        return false;
+    }
+
+    NativeBinaryCache::recordHit(cacheKey);
+    outProgram = program;
+    return true;
+}
+} // namespace
+
 TestResult OCL::ProgramHelperOcl::buildProgramFromSource(cl_context context, cl_device_id device, const char *source, size_t sourceLength, const char *compileOptions, cl_program &outProgram) {
     FATAL_ERROR_IF(outProgram != nullptr, "Non-null program passed");
 
+    std::string cacheKey{};
+    if (NativeBinaryCache::isEnabled()) {
+        cacheKey = NativeBinaryCache::getKey(source, sourceLength, getDeviceKey(device), compileOptions);
+        if (buildProgramFromCachedBinary(context, device, cacheKey, compileOptions, outProgram)) {
+            return TestResult::Success;
+        }
+    }
+
     cl_int retVal{};
     cl_program program = clCreateProgramWithSource(context, 1, &source, &sourceLength, &retVal);
     ASSERT_CL_SUCCESS(retVal);
 
+    const auto compileStart = std::chrono::steady_clock::now();
     retVal = clBuildProgram(program, 1, &device, compileOptions, nullptr, nullptr);
+    const auto compileTime = std::chrono::steady_clock::now() - compileStart;
     if (retVal != CL_SUCCESS) {
         size_t logSize{};
         ASSERT_CL_SUCCESS(clGetProgramBuildInfo(program, device, CL_PROGRAM_BUILD_LOG, 0, nullptr, &logSize));
@@ -29,12 +85,25 @@ TestResult OCL::ProgramHelperOcl::buildProgramFromSource(cl_context context, cl_
         return TestResult::KernelBuildError;
     }
 
+    if (!cacheKey.empty()) {
+        size_t binarySize{};
+        std::vector<uint8_t> binary;
+        if (clGetProgramInfo(program, CL_PROGRAM_BINARY_SIZES, sizeof(binarySize), &binarySize, nullptr) == CL_SUCCESS && binarySize > 0) {
+            binary.resize(binarySize);
+            unsigned char *binaries[] = {binary.data()};
+            if (clGetProgramInfo(program, CL_PROGRAM_BINARIES, sizeof(binaries), binaries, nullptr) != CL_SUCCESS) {
+                binary.clear();
+            }
+        }
+        NativeBinaryCache::recordMiss(cacheKey, std::move(binary), std::chrono::duration_cast<std::chrono::nanoseconds>(compileTime));
+    }
+
     outProgram = program;
     return TestResult::Success;
 }
 
 TestResult OCL::ProgramHelperOcl::buildProgramFromSourceFile(cl_context context, cl_device_id device, const char *sourceFileName, const char *compileOptions, cl_program &outProgram) {
-    const std::vector<uint8_t> kernelSource = FileHelper::loadTextFile(sourceFileName);
+    const auto kernelSource = KernelRegistry::get(sourceFileName);
     if (kernelSource.size() == 0) {
         return TestResult::KernelNotFound;
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,8 @@
 
 namespace OCL {
 struct ProgramHelperOcl {
+    // With --moduleCache, programs are created from the binary of an earlier build of the same source
+    // with the same options instead of compiling it again
     static TestResult buildProgramFromSource(cl_context context,
                                              cl_device_id device,
                                              const char *source,
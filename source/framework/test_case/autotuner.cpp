@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "autotuner.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+Autotuner::Autotuner(std::vector<size_t> valueCounts, size_t budget)
+    : valueCounts(std::move(valueCounts)),
+      budget(budget) {}
+
+void Autotuner::search(const IsValidFunction &isValid, const MeasureFunction &measure) {
+    Point start{};
+    for (const size_t valueCount : valueCounts) {
+        start.push_back(valueCount / 2);
+    }
+    tryPoint(start, isValid, measure);
+
+    // Without a result in the middle, the search starts from the first point which has one
+    for (Point point(valueCounts.size(), 0u); !best && measuredCount < budget;) {
+        tryPoint(point, isValid, measure);
+
+        size_t index = valueCounts.size();
+        for (; index > 0 && ++point[index - 1] == valueCounts[index - 1]; index--) {
+            point[index - 1] = 0;
+        }
+        if (index == 0) {
+            break;
+        }
+    }
+
+    for (bool improved = best.has_value(); improved && measuredCount < budget;) {
+        improved = false;
+        roundCount++;
+        for (size_t index = 0; index < valueCounts.size(); index++) {
+            for (size_t value = 0; value < valueCounts[index]; value++) {
+                Point candidate = *best;
+                candidate[index] = value;
+                improved |= tryPoint(candidate, isValid, measure);
+            }
+        }
+    }
+}
+
+bool Autotuner::tryPoint(const Point &point, const IsValidFunction &isValid, const MeasureFunction &measure) {
+    if (measuredCount == budget || explored.find(point) != explored.end()) {
+        return false;
+    }
+
+    Candidate &candidate = explored[point];
+    candidate.valid = isValid(point);
+    if (!candidate.valid) {
+        return false;
+    }
+    measuredCount++;
+    candidate.measurement = measure(point);
+    if (!candidate.measurement) {
+        return false;
+    }
+
+    if (best && getScore(*candidate.measurement) <= getScore(*explored.at(*best).measurement)) {
+        return false;
+    }
+    best = point;
+    return true;
+}
+
+double Autotuner::getScore(const Measurement &measurement) {
+    switch (measurement.result.unit) {
+    case MeasurementUnit::GigabytesPerSecond:
+    case MeasurementUnit::GigaFLOPS:
+        return measurement.result.median;
+    default:
+        return -measurement.result.median;
+    }
+}
+
+std::string Autotuner::renderReport() const {
+    size_t pointCount = 1;
+    for (const size_t valueCount : valueCounts) {
+        pointCount *= valueCount;
+    }
+    std::vector<const Measurement *> measurements{};
+    size_t invalidCount = 0;
+    size_t failedCount = 0;
+    for (const auto &[point, candidate] : explored) {
+        if (candidate.measurement) {
+            measurements.push_back(&*candidate.measurement);
+        } else if (candidate.valid) {
+            failedCount++;
+        } else {
+            invalidCount++;
+        }
+    }
+    std::stable_sort(measurements.begin(), measurements.end(), [](const Measurement *a, const Measurement *b) { return getScore(*a) > getScore(*b); });
+
+    std::ostringstream report;
+    report << "Autotune: measured " << measuredCount << " of " << pointCount << " configurations in " << roundCount << " rounds";
+    report << " (" << failedCount << " failed, " << invalidCount << " skipped as invalid";
+    if (measuredCount == budget) {
+        report << ", --autotuneBudget reached";
+    }
+    report << ")\n";
+    if (measurements.empty()) {
+        report << "No configuration gave a result\n";
+        return report.str();
+    }
+
+    const auto renderMeasurement = [&report](const Measurement &measurement) {
+        report << std::fixed << std::setprecision(3) << measurement.result.median << ' ' << std::to_string(measurement.result.unit)
+               << "  " << measurement.name << '\n';
+    };
+    report << "Best: ";
+    renderMeasurement(*measurements[0]);
+    report << "Explored, best first:\n";
+    for (const Measurement *measurement : measurements) {
+        report << '\t';
+        renderMeasurement(*measurement);
+    }
+    return report.str();
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/test_case/test_case_statistics.h"
+
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Searches the values of the arguments swept with --autotune for the best result of a test, instead of
+// running every point of the sweep. It is a coordinate descent - starting from the middle value of each
+// argument, all values of one argument are tried with the others fixed at the best point found so far,
+// argument after argument, until a whole round brings no improvement or --autotuneBudget points were
+// measured. Points rejected by the test's argument validation are skipped and not counted.
+//
+// Time is minimized, bandwidth and FLOPS are maximized. The median of the first result of the test is compared.
+class Autotuner {
+  public:
+    using Point = std::vector<size_t>; // index of the value of each tuned argument
+    struct Measurement {
+        std::string name; // command line of the point
+        TestCaseStatistics::MainResult result;
+    };
+    using IsValidFunction = std::function<bool(const Point &)>;
+    using MeasureFunction = std::function<std::optional<Measurement>(const Point &)>; // nullopt if the test failed
+
+    Autotuner(std::vector<size_t> valueCounts, size_t budget);
+
+    void search(const IsValidFunction &isValid, const MeasureFunction &measure);
+    std::string renderReport() const;
+
+  private:
+    struct Candidate {
+        bool valid;
+        std::optional<Measurement> measurement;
+    };
+
+    bool tryPoint(const Point &point, const IsValidFunction &isValid, const MeasureFunction &measure);
+    static double getScore(const Measurement &measurement);
+
+    const std::vector<size_t> valueCounts;
+    const size_t budget;
+    std::map<Point, Candidate> explored = {};
+    std::optional<Point> best = {};
+    size_t measuredCount = 0;
+    size_t roundCount = 0;
+};
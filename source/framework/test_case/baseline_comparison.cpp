@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "baseline_comparison.h"
+
+#include "framework/configuration.h"
+#include "framework/utility/json_helper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+
+std::map<std::string, BaselineComparison::Entry> BaselineComparison::entries;
+bool BaselineComparison::loaded = false;
+bool BaselineComparison::regressionFound = false;
+
+bool BaselineComparison::load(const std::string &filePath) {
+    std::ifstream file(filePath);
+    if (!file) {
+        std::cerr << "ERROR: cannot open baseline file: " << filePath << '\n';
+        return false;
+    }
+
+    std::string line{};
+    for (size_t lineNumber = 1; std::getline(file, line); lineNumber++) {
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {
+            continue;
+        }
+        JsonHelper::Value record{};
+        if (!JsonHelper::parse(line, record) || record.find("name") == nullptr) {
+            std::cerr << "ERROR: line " << lineNumber << " of baseline file " << filePath << " is not a --jsonOutput record\n";
+            return false;
+        }
+        const JsonHelper::Value *metrics = record.find("metrics");
+        if (metrics == nullptr) {
+            continue;
+        }
+
+        for (const JsonHelper::Value &metric : metrics->array) {
+            const JsonHelper::Value *label = metric.find("label");
+            const JsonHelper::Value *median = metric.find("median");
+            if (label == nullptr || median == nullptr || median->type != JsonHelper::Value::Type::Number) {
+                continue;
+            }
+
+            Entry entry{};
+            entry.median = median->number;
+            if (const JsonHelper::Value *rawSamples = metric.find("rawSamples"); rawSamples != nullptr) {
+                std::vector<Value> values{};
+                for (const JsonHelper::Value &sample : rawSamples->array) {
+                    if (sample.type == JsonHelper::Value::Type::Number) {
+                        values.push_back(sample.number);
+                    }
+                }
+                std::sort(values.begin(), values.end());
+                for (const Value value : values) {
+                    if (entry.samples.empty() || entry.samples.back().first != value) {
+                        entry.samples.push_back({value, 0});
+                    }
+                    entry.samples.back().second++;
+                }
+            }
+            entries[getKey(record.find("name")->string, label->string)] = std::move(entry);
+        }
+    }
+
+    loaded = true;
+    return true;
+}
+
+BaselineComparison::Result BaselineComparison::compare(const std::string &testCaseName, const std::string &label, MeasurementUnit unit, const WeightedSamples &samples, Value median) {
+    const auto it = entries.find(getKey(testCaseName, label));
+    if (it == entries.end()) {
+        return {};
+    }
+    const Entry &baseline = it->second;
+
+    Result result{};
+    result.verdict = Verdict::NoChange;
+    result.deltaPercentage = baseline.median != 0 ? (median - baseline.median) / std::fabs(baseline.median) * 100 : 0;
+
+    // Without raw samples in the baseline only the threshold can be checked
+    bool isSignificant = true;
+    result.pValue = std::numeric_limits<double>::quiet_NaN();
+    if (!baseline.samples.empty()) {
+        result.pValue = calculateMannWhitneyPValue(samples, baseline.samples);
+        isSignificant = result.pValue < significanceLevel;
+    }
+
+    if (isSignificant && std::fabs(result.deltaPercentage) >= Configuration::get().regressionThreshold) {
+        const bool isWorse = isHigherBetter(unit) ? result.deltaPercentage < 0 : result.deltaPercentage > 0;
+        result.verdict = isWorse ? Verdict::Regression : Verdict::Improvement;
+        regressionFound |= isWorse;
+    }
+    return result;
+}
+
+double BaselineComparison::calculateMannWhitneyPValue(const WeightedSamples &first, const WeightedSamples &second) {
+    size_t firstCount = 0;
+    size_t secondCount = 0;
+    for (const auto &sample : first) {
+        firstCount += sample.second;
+    }
+    for (const auto &sample : second) {
+        secondCount += sample.second;
+    }
+    if (firstCount == 0 || secondCount == 0) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    // Walk both sorted lists together, giving every group of equal values their average rank.
+    // Ranks are kept doubled, so the average ranks of ties stay integers.
+    size_t firstDoubledRankSum = 0;
+    double tieCorrection = 0;
+    size_t rankedCount = 0;
+    std::vector<std::pair<size_t, size_t>> doubledRanks{}; // (doubled rank, count) of each group of ties
+    for (size_t i = 0, j = 0; i < first.size() || j < second.size();) {
+        Value value = i < first.size() ? first[i].first : second[j].first;
+        if (j < second.size()) {
+            value = std::min(value, second[j].first);
+        }
+        size_t firstTies = 0;
+        size_t secondTies = 0;
+        for (; i < first.size() && first[i].first == value; i++) {
+            firstTies += first[i].second;
+        }
+        for (; j < second.size() && second[j].first == value; j++) {
+            secondTies += second[j].second;
+        }
+        const size_t ties = firstTies + secondTies;
+        const size_t doubledRank = 2 * rankedCount + ties + 1;
+        firstDoubledRankSum += firstTies * doubledRank;
+        tieCorrection += static_cast<double>(ties) * static_cast<double>(ties) * static_cast<double>(ties) - static_cast<double>(ties);
+        doubledRanks.push_back({doubledRank, ties});
+        rankedCount += ties;
+    }
+
+    if (firstCount + secondCount <= maxExactSamplesCount) {
+        return calculateExactRankSumPValue(doubledRanks, firstCount, firstDoubledRankSum);
+    }
+
+    // Normal approximation of the U statistic with tie and continuity corrections, accurate
+    // with more than maxExactSamplesCount values in total
+    const double n1 = static_cast<double>(firstCount);
+    const double n2 = static_cast<double>(secondCount);
+    const double n = n1 + n2;
+    const double u = static_cast<double>(firstDoubledRankSum) / 2 - n1 * (n1 + 1) / 2;
+    const double mean = n1 * n2 / 2;
+    const double variance = n1 * n2 / 12 * ((n + 1) - tieCorrection / (n * (n - 1)));
+    if (!(variance > 0)) {
+        return 1;
+    }
+    const double z = std::max(0.0, std::fabs(u - mean) - 0.5) / std::sqrt(variance);
+    return std::erfc(z / std::sqrt(2.0));
+}
+
+double BaselineComparison::calculateExactRankSumPValue(const std::vector<std::pair<size_t, size_t>> &doubledRanks, size_t firstCount, size_t firstDoubledRankSum) {
+    // Counts the ways of drawing firstCount of the pooled ranks for each possible rank sum. With
+    // all of them equally likely under the null hypothesis this is the exact distribution of the
+    // statistic, ties included. Both the sums and the counts fit doubles exactly at this size.
+    size_t totalCount = 0;
+    size_t maxDoubledSum = 0;
+    for (const auto &[doubledRank, count] : doubledRanks) {
+        totalCount += count;
+        maxDoubledSum += doubledRank * count;
+    }
+    std::vector<std::vector<double>> ways(firstCount + 1, std::vector<double>(maxDoubledSum + 1, 0));
+    ways[0][0] = 1;
+    size_t drawnCount = 0;
+    for (const auto &[doubledRank, count] : doubledRanks) {
+        for (size_t c = 0; c < count; c++) {
+            drawnCount++;
+            for (size_t k = std::min(drawnCount, firstCount); k > 0; k--) {
+                for (size_t sum = maxDoubledSum; sum >= doubledRank; sum--) {
+                    ways[k][sum] += ways[k - 1][sum - doubledRank];
+                }
+            }
+        }
+    }
+
+    // Two-sided, sums at least as far from the expected one as the observed sum
+    const double expectedDoubledSum = static_cast<double>(firstCount) * static_cast<double>(totalCount + 1);
+    const double observedDistance = std::fabs(static_cast<double>(firstDoubledRankSum) - expectedDoubledSum);
+    double extremeWays = 0;
+    double allWays = 0;
+    for (size_t sum = 0; sum <= maxDoubledSum; sum++) {
+        allWays += ways[firstCount][sum];
+        if (std::fabs(static_cast<double>(sum) - expectedDoubledSum) >= observedDistance - 1e-9) {
+            extremeWays += ways[firstCount][sum];
+        }
+    }
+    return allWays > 0 ? std::min(1.0, extremeWays / allWays) : 1;
+}
+
+std::string BaselineComparison::getKey(const std::string &testCaseName, const std::string &label) {
+    return testCaseName + '\n' + label;
+}
+
+bool BaselineComparison::isHigherBetter(MeasurementUnit unit) {
+    switch (unit) {
+    case MeasurementUnit::GigabytesPerSecond:
+    case MeasurementUnit::GigaFLOPS:
+    case MeasurementUnit::Ratio:     // instructions per cycle
+    case MeasurementUnit::Gigahertz: // effective frequency
+        return true;
+    default:
+        return false;
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/enum/measurement_unit.h"
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Compares results of the current run with the --jsonOutput file of an earlier run, passed as
+// --baseline. Samples of each metric are compared with a two-sided Mann-Whitney U test, which
+// does not assume any distribution of the timings. A metric is flagged as a regression or an
+// improvement when the difference is significant and its median moved by more than
+// --regressionThreshold. The baseline must be written with --jsonRawSamples for the test
+// to be done - without raw samples only the medians are compared.
+class BaselineComparison {
+  public:
+    using Value = double;
+    using WeightedSamples = std::vector<std::pair<Value, size_t>>; // (value, count) sorted by value
+    static constexpr double significanceLevel = 0.05;
+    static constexpr size_t maxExactSamplesCount = 40; // both sides together, above it the p-value is approximated
+
+    enum class Verdict {
+        NoBaseline,
+        NoChange,
+        Improvement,
+        Regression,
+    };
+
+    struct Result {
+        Verdict verdict = Verdict::NoBaseline;
+        double deltaPercentage = 0;
+        double pValue = 0; // nan if the baseline has no raw samples
+    };
+
+    static bool load(const std::string &filePath);
+    static bool isLoaded() { return loaded; }
+    static bool wasRegressionFound() { return regressionFound; }
+    static void markRegressionFound() { regressionFound = true; } // found by a process running the test, with --isolate
+
+    static Result compare(const std::string &testCaseName, const std::string &label, MeasurementUnit unit, const WeightedSamples &samples, Value median);
+    static double calculateMannWhitneyPValue(const WeightedSamples &first, const WeightedSamples &second);
+
+  private:
+    struct Entry {
+        Value median = 0;
+        WeightedSamples samples = {};
+    };
+
+    static double calculateExactRankSumPValue(const std::vector<std::pair<size_t, size_t>> &doubledRanks, size_t firstCount, size_t firstDoubledRankSum);
+    static std::string getKey(const std::string &testCaseName, const std::string &label);
+    static bool isHigherBetter(MeasurementUnit unit);
+
+    static std::map<std::string, Entry> entries;
+    static bool loaded;
+    static bool regressionFound;
+};
+
+namespace std {
+inline std::string to_string(BaselineComparison::Verdict verdict) {
+    switch (verdict) {
+    case BaselineComparison::Verdict::NoBaseline:
+        return "NO_BASELINE";
+    case BaselineComparison::Verdict::NoChange:
+        return "-";
+    case BaselineComparison::Verdict::Improvement:
+        return "improvement";
+    case BaselineComparison::Verdict::Regression:
+        return "REGRESSION";
+    default:
+        FATAL_ERROR("Unknown verdict");
+    }
+}
+} // namespace std
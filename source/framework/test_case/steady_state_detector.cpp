@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "steady_state_detector.h"
+
+#include <algorithm>
+#include <cmath>
+
+size_t SteadyStateDetector::findSteadyStateStart(std::vector<Value>::const_iterator begin, std::vector<Value>::const_iterator end) {
+    const size_t count = static_cast<size_t>(std::distance(begin, end));
+    if (count < minimumSampleCount) {
+        return 0;
+    }
+    const size_t halfCount = count / 2;
+
+    std::vector<Value> secondHalf(begin + halfCount, end);
+    const Value reference = calculateMedian(secondHalf);
+    for (Value &value : secondHalf) {
+        value = std::fabs(value - reference);
+    }
+    const Value sigma = 1.4826 * calculateMedian(secondHalf); // MAD scaled to the standard deviation of normal distribution
+
+    // Standard error of a median of windowSize samples is about 1.2533 * sigma / sqrt(windowSize)
+    const size_t windowSize = std::max(minimumWindowSize, count / 20);
+    const Value tolerance = std::max(3 * 1.2533 * sigma / std::sqrt(static_cast<Value>(windowSize)),
+                                     minimumRelativeTolerance * std::fabs(reference));
+
+    // Windows overlap by 3/4, which is precise enough and keeps the cost linear in count
+    const size_t step = std::max<size_t>(1, windowSize / 4);
+    std::vector<Value> window(windowSize);
+    for (size_t start = 0; start + windowSize <= halfCount; start += step) {
+        std::copy(begin + start, begin + start + windowSize, window.begin());
+        if (std::fabs(calculateMedian(window) - reference) <= tolerance) {
+            return start;
+        }
+    }
+    return halfCount;
+}
+
+SteadyStateDetector::Value SteadyStateDetector::calculateMedian(std::vector<Value> &values) {
+    const auto middle = values.begin() + values.size() / 2;
+    std::nth_element(values.begin(), middle, values.end());
+    return *middle;
+}
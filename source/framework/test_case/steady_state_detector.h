@@ -0,0 +1,30 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// Finds where a series of samples reaches steady state, used by TestCaseStatistics when --autoWarmup
+// is passed. The second half of the series is taken as the steady-state reference. A window of 5% of
+// the samples slides from the beginning until its median is within the noise of the reference median
+// (3 standard errors, estimated robustly from the median absolute deviation). Samples before that
+// window are warmup. At most half of the samples are ever discarded, so a series which keeps drifting
+// for the whole run still has its second half reported.
+struct SteadyStateDetector {
+    using Value = double;
+    static constexpr size_t minimumSampleCount = 20;
+    static constexpr size_t minimumWindowSize = 5;
+    static constexpr double minimumRelativeTolerance = 0.005;
+
+    // Returns the number of leading samples to discard
+    static size_t findSteadyStateStart(std::vector<Value>::const_iterator begin, std::vector<Value>::const_iterator end);
+
+  private:
+    static Value calculateMedian(std::vector<Value> &values);
+};
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "streaming_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+StreamingHistogram::StreamingHistogram(double relativeAccuracy, size_t maxBucketCount)
+    : gamma((1 + relativeAccuracy) / (1 - relativeAccuracy)),
+      logGamma(std::log(gamma)),
+      maxBucketCount(std::max<size_t>(maxBucketCount, 1)) {
+}
+
+void StreamingHistogram::push(Value value) {
+    count++;
+    if (count == 1) {
+        min = value;
+        max = value;
+    } else {
+        min = std::min(min, value);
+        max = std::max(max, value);
+    }
+
+    // Welford's online algorithm, so no sums of large values have to be kept around
+    const Value delta = value - mean;
+    mean += delta / static_cast<Value>(count);
+    sumOfSquaredDifferences += delta * (value - mean);
+
+    const Value magnitude = std::fabs(value);
+    if (!(magnitude >= std::numeric_limits<Value>::min())) {
+        zeroCount++;
+    } else if (value > 0) {
+        positiveStore.add(getBucketIndex(magnitude), maxBucketCount);
+    } else {
+        negativeStore.add(getBucketIndex(magnitude), maxBucketCount);
+    }
+}
+
+StreamingHistogram::Value StreamingHistogram::getStandardDeviation() const {
+    if (count == 0) {
+        return 0;
+    }
+    return std::sqrt(sumOfSquaredDifferences / static_cast<Value>(count));
+}
+
+StreamingHistogram::Value StreamingHistogram::getQuantile(double quantile) const {
+    if (count == 0) {
+        return 0;
+    }
+    if (quantile <= 0) {
+        return min;
+    }
+    if (quantile >= 1) {
+        return max;
+    }
+
+    const double rank = quantile * static_cast<double>(count - 1);
+    double cumulative = 0;
+    Value result = max;
+    bool found = false;
+    forEachBucket([&](Value bucketValue, size_t bucketCount) {
+        if (found) {
+            return;
+        }
+        cumulative += static_cast<double>(bucketCount);
+        if (rank < cumulative) {
+            result = bucketValue;
+            found = true;
+        }
+    });
+    return result;
+}
+
+void StreamingHistogram::Store::add(int index, size_t maxBucketCount) {
+    if (counts.empty()) {
+        offset = index;
+        counts.push_back(0);
+    }
+
+    const int currentHighest = offset + static_cast<int>(counts.size()) - 1;
+    if (index < offset || index > currentHighest) {
+        // Grow the window of buckets. If it would exceed the cap, fold the lowest ones together.
+        const int highest = std::max(currentHighest, index);
+        const int lowest = std::max(std::min(offset, index), highest - static_cast<int>(maxBucketCount) + 1);
+        std::vector<uint64_t> resized(static_cast<size_t>(highest - lowest + 1), 0);
+        for (size_t i = 0; i < counts.size(); i++) {
+            const int target = std::max(offset + static_cast<int>(i), lowest) - lowest;
+            resized[static_cast<size_t>(target)] += counts[i];
+        }
+        counts = std::move(resized);
+        offset = lowest;
+    }
+
+    counts[static_cast<size_t>(std::max(index, offset) - offset)]++;
+}
+
+int StreamingHistogram::getBucketIndex(Value magnitude) const {
+    magnitude = std::min(magnitude, std::numeric_limits<Value>::max());
+    return static_cast<int>(std::ceil(std::log(magnitude) / logGamma));
+}
+
+StreamingHistogram::Value StreamingHistogram::getBucketValue(int index) const {
+    // Bucket i holds values in (gamma^(i-1), gamma^i]. This point is within relativeAccuracy of all of them.
+    return 2 * std::pow(gamma, static_cast<double>(index)) / (gamma + 1);
+}
+
+StreamingHistogram::Value StreamingHistogram::clamp(Value value) const {
+    return std::clamp(value, min, max);
+}
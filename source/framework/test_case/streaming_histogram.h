@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Fixed-memory summary of a stream of samples, used by TestCaseStatistics when
+// --streamingStatistics is passed. Values are counted in logarithmically sized buckets
+// (each bucket spans a factor of gamma = (1 + alpha) / (1 - alpha)), so any quantile is
+// reported within relative error alpha of the exact one. Count, mean, standard deviation,
+// min and max are tracked exactly. Positive and negative values are kept in separate
+// stores, each capped at maxBucketCount buckets - when a store would grow past the cap,
+// its lowest-magnitude buckets are collapsed into one. Memory is therefore bounded no
+// matter how many samples are pushed or how wide their range is.
+class StreamingHistogram {
+  public:
+    using Value = double;
+    static constexpr double defaultRelativeAccuracy = 0.005;
+    static constexpr size_t defaultMaxBucketCount = 4096;
+
+    explicit StreamingHistogram(double relativeAccuracy = defaultRelativeAccuracy, size_t maxBucketCount = defaultMaxBucketCount);
+
+    void push(Value value);
+
+    size_t getCount() const { return count; }
+    Value getMin() const { return min; }
+    Value getMax() const { return max; }
+    Value getMean() const { return mean; }
+    Value getStandardDeviation() const;
+    Value getQuantile(double quantile) const;
+
+    // Calls callback(Value representativeValue, size_t count) for every non-empty bucket
+    // in ascending order of values. Representative values are clamped to [min, max].
+    template <typename Callback>
+    void forEachBucket(Callback &&callback) const {
+        for (size_t i = negativeStore.counts.size(); i-- > 0;) {
+            if (negativeStore.counts[i] != 0) {
+                callback(clamp(-getBucketValue(negativeStore.offset + static_cast<int>(i))), static_cast<size_t>(negativeStore.counts[i]));
+            }
+        }
+        if (zeroCount != 0) {
+            callback(clamp(0), static_cast<size_t>(zeroCount));
+        }
+        for (size_t i = 0; i < positiveStore.counts.size(); i++) {
+            if (positiveStore.counts[i] != 0) {
+                callback(clamp(getBucketValue(positiveStore.offset + static_cast<int>(i))), static_cast<size_t>(positiveStore.counts[i]));
+            }
+        }
+    }
+
+  private:
+    struct Store {
+        std::vector<uint64_t> counts = {};
+        int offset = 0;
+
+        void add(int index, size_t maxBucketCount);
+    };
+
+    int getBucketIndex(Value magnitude) const;
+    Value getBucketValue(int index) const;
+    Value clamp(Value value) const;
+
+    const double gamma;
+    const double logGamma;
+    const size_t maxBucketCount;
+
+    Store positiveStore = {};
+    Store negativeStore = {};
+    uint64_t zeroCount = 0;
+
+    size_t count = 0;
+    Value min = 0;
+    Value max = 0;
+    Value mean = 0;
+    Value sumOfSquaredDifferences = 0;
+};
@@ -8,15 +8,19 @@
 #pragma once
 #include "framework/benchmark_info.h"
 #include "framework/supported_apis.h"
+#include "framework/test_case/autotuner.h"
 #include "framework/test_case/test_case_argument_container.h"
 #include "framework/test_case/test_case_base.h"
 #include "framework/test_case/test_case_statistics.h"
 #include "framework/test_case/test_result.h"
 #include "framework/test_map.h"
+#include "framework/utility/api_call_statistics.h"
 #include "framework/utility/common_help_message.h"
 #include "framework/utility/error.h"
+#include "framework/utility/os_noise_monitor.h"
 #include "framework/utility/sleep.h"
 #include "framework/utility/string_utils.h"
+#include "framework/utility/trace_recorder.h"
 
 #include <functional>
 #include <iostream>
@@ -51,15 +55,22 @@ class TestCase : public TestCaseBase {
     }
 
     bool runFromCommandLine(CommandLineArguments &commandLineArguments) override {
+        // Arguments given as lists or ranges are swept, e.g. --size=4KB..1GB:x2 --wgs=32,64,256
+        std::vector<SweptArgument> sweptArguments{};
+        if (!getSweptArguments(ArgumentContainerT{}, commandLineArguments, sweptArguments)) {
+            return false;
+        }
+        CommandLineArguments pointArguments = getSweepPoint(commandLineArguments, sweptArguments, std::vector<size_t>(sweptArguments.size(), 0u));
+
         // Parse test-specific parameters
         ArgumentContainerT arguments;
         bool error = false;
-        if (!parseArguments(arguments, commandLineArguments)) {
+        if (!parseArguments(arguments, pointArguments)) {
             return false;
         }
 
         // Check if all command line arguments were processed (no ignoring)
-        if (const auto unprocessedArgs = CommandLineArgument::getUnprocessedArguments(commandLineArguments); !unprocessedArgs.empty()) {
+        if (const auto unprocessedArgs = CommandLineArgument::getUnprocessedArguments(pointArguments); !unprocessedArgs.empty()) {
             const auto getKey = +[](const CommandLineArgument *a) { return a->getKey(); };
             std::cerr << CommonHelpMessage::errorIgnoredCommandLineArgs() << joinStrings(", ", unprocessedArgs, getKey) << std::endl;
             error = true;
@@ -72,43 +83,81 @@ class TestCase : public TestCaseBase {
             error = true;
         }
 
+        // With --autotune the swept arguments are searched for the best result, instead of running all their values
+        Api api = Api::All;
+        if (!Configuration::get().autotune.get().empty() && !prepareAutotune(commandLineArguments, sweptArguments, api)) {
+            error = true;
+        }
+
         if (error) {
             return false;
         }
 
+        // Lines of a --plan are printed as one table, BenchmarkMain prints its header and flushes it
+        const bool isPlanLine = !static_cast<const std::string &>(Configuration::get().plan).empty();
+
         // For CSV, print the header immediately before any rows (same as AllTestsGtestListener::OnTestProgramStart)
-        if (!Configuration::get().noColumnNames && Configuration::get().printType == Configuration::PrintType::Csv) {
+        if (!isPlanLine && !Configuration::get().noColumnNames && Configuration::get().printType == Configuration::PrintType::Csv) {
             TestCaseStatistics::printStatisticsHeader(Configuration::get().printType, 0);
         }
-        // Try running with all possible APIs. If some are disabled, e.g. --api=ocl is passed, then the rest will be skipped in run() method
-        for (int apiIndex = static_cast<int>(Api::FIRST); apiIndex <= static_cast<int>(Api::LAST); apiIndex++) {
-            arguments.api = static_cast<Api>(apiIndex);
-            run(arguments);
+        if (!Configuration::get().autotune.get().empty()) {
+            autotune(commandLineArguments, sweptArguments, api);
+        } else {
+            runSweep(commandLineArguments, sweptArguments);
+        }
+        if (!isPlanLine) {
+            TestCaseStatistics::flushBufferedResults(Configuration::get().printType);
         }
-        TestCaseStatistics::flushBufferedResults(Configuration::get().printType);
         return true;
     }
 
-    void run(ArgumentContainerT &arguments) const {
-        arguments.iterations = Configuration::get().iterations;
+    void run(ArgumentContainerT &arguments, std::optional<TestCaseStatistics::MainResult> *outMainResult = nullptr) const {
+        if (!isRunByThisShard(arguments)) {
+            return;
+        }
+        if (Configuration::get().isolate && !arguments.isSingleTestMode && isApiImplemented(arguments.api) && isSelectedByFilters(arguments)) {
+            runInSeparateProcess(arguments);
+            return;
+        }
+
+        // With target relative error the test starts with minIterations and may be rerun in bigger batches
+        const bool adaptiveIterations = Configuration::get().targetRelativeError > 0;
+        const size_t maxIterations = adaptiveIterations ? Configuration::get().maxIterations : Configuration::get().iterations;
+        arguments.iterations = adaptiveIterations ? Configuration::get().minIterations : Configuration::get().iterations;
         arguments.noIntelExtensions = Configuration::get().noIntelExtensions;
         arguments.warmupIterations = Configuration::get().warmupIterations;
         arguments.iterations += arguments.warmupIterations;
 
         // Create statistics object
         const auto testCaseNameWithConfig = getTestCaseNameWithConfig(arguments, Configuration::get().dumpCommandLines);
-        TestCaseStatistics statistics{arguments.iterations, Configuration::get().printType};
+        TestCaseStatistics statistics{maxIterations + arguments.warmupIterations, Configuration::get().printType};
 
         // Run test
-        const auto testResult = runImpl(statistics, arguments, testCaseNameWithConfig);
+        TraceRecorder::startTest();
+        ApiCallStatistics::startTest();
+        OsNoiseMonitor::startTest();
+        auto testResult = runImpl(statistics, arguments, testCaseNameWithConfig);
+        while (adaptiveIterations && testResult == TestResult::Success && statistics.needsMoreSamples()) {
+            statistics.startNextBatch();
+            arguments.iterations = arguments.warmupIterations + statistics.getNextBatchSize();
+            testResult = runImpl(statistics, arguments, testCaseNameWithConfig);
+        }
+        TraceRecorder::finishTest(testCaseNameWithConfig);
         if (testResult == TestResult::Success) {
-            DEVELOPER_WARNING_IF(!statistics.isFull(), "test did not generate as many values as expected");
+            DEVELOPER_WARNING_IF(!adaptiveIterations && !statistics.isFull(), "test did not generate as many values as expected");
+            statistics.finishMeasurements();
+            if (outMainResult != nullptr) {
+                *outMainResult = statistics.getMainResult();
+            }
             statistics.printStatistics(testCaseNameWithConfig);
+            statistics.writeJsonResult(getTestCaseName(), testCaseNameWithConfig, arguments, testResult);
+            statistics.writeTimeline(testCaseNameWithConfig);
             if (Configuration::get().sleepFor > 0) {
                 sleep(std::chrono::milliseconds(Configuration::get().sleepFor));
             }
         } else if (testResult == TestResult::Nooped) {
             statistics.printStatistics(testCaseNameWithConfig);
+            statistics.writeJsonResult(getTestCaseName(), testCaseNameWithConfig, arguments, testResult);
         } else {
             const auto &testResultInfo = TestResultHelper::getTestResultInfo(testResult);
 
@@ -116,15 +165,66 @@ class TestCase : public TestCaseBase {
             DEVELOPER_WARNING_IF(testResultInfo.wasTestSkipped && !statistics.isEmpty(), "test was skipped but generated some values");
 
             // Print output line with error info if needed
+            // A test run with --isolate is a part of all-tests mode
+            const bool isSingleTestOutput = arguments.isSingleTestMode && !Configuration::get().isolatedTest;
             const auto printMessage = (Configuration::get().printAllResults && testResultInfo.printInPrintAllResultsMode) ||
-                                      (arguments.isSingleTestMode ? testResultInfo.printInSingleTestMode : testResultInfo.printInAllTestsMode);
+                                      (isSingleTestOutput ? testResultInfo.printInSingleTestMode : testResultInfo.printInAllTestsMode);
             if (printMessage) {
                 statistics.printStatisticsString(testCaseNameWithConfig, testResultInfo.stringMessage);
+                statistics.writeJsonResult(getTestCaseName(), testCaseNameWithConfig, arguments, testResult);
             }
         }
     }
 
   private:
+    void runSweep(const CommandLineArguments &commandLineArguments, const std::vector<SweptArgument> &sweptArguments) const {
+        std::vector<size_t> sweepPoint(sweptArguments.size(), 0u);
+        do {
+            // Every point is parsed from the same arguments, so the checks above hold for all of them
+            ArgumentContainerT pointContainer;
+            CommandLineArguments pointArguments = getSweepPoint(commandLineArguments, sweptArguments, sweepPoint);
+            parseArguments(pointContainer, pointArguments);
+
+            // Try running with all possible APIs. If some are disabled, e.g. --api=ocl is passed, then the rest will be skipped in run() method
+            for (int apiIndex = static_cast<int>(Api::FIRST); apiIndex <= static_cast<int>(Api::LAST); apiIndex++) {
+                pointContainer.api = static_cast<Api>(apiIndex);
+                run(pointContainer);
+            }
+        } while (selectNextSweepPoint(sweptArguments, sweepPoint));
+    }
+
+    void autotune(const CommandLineArguments &commandLineArguments, const std::vector<SweptArgument> &sweptArguments, Api api) const {
+        std::vector<size_t> valueCounts{};
+        for (const SweptArgument &sweptArgument : sweptArguments) {
+            valueCounts.push_back(sweptArgument.values.size());
+        }
+        const auto parsePoint = [&](const Autotuner::Point &point, ArgumentContainerT &outArguments) {
+            CommandLineArguments pointArguments = getSweepPoint(commandLineArguments, sweptArguments, point);
+            parseArguments(outArguments, pointArguments);
+            outArguments.api = api;
+            outArguments.iterations = Configuration::get().iterations; // set again by run(), but validated before it
+        };
+        const auto isValid = [&](const Autotuner::Point &point) {
+            ArgumentContainerT pointContainer;
+            parsePoint(point, pointContainer);
+            return pointContainer.validateArguments();
+        };
+        const auto measure = [&](const Autotuner::Point &point) -> std::optional<Autotuner::Measurement> {
+            ArgumentContainerT pointContainer;
+            parsePoint(point, pointContainer);
+            std::optional<TestCaseStatistics::MainResult> mainResult{};
+            run(pointContainer, &mainResult);
+            if (!mainResult) {
+                return std::nullopt;
+            }
+            return Autotuner::Measurement{getTestCaseNameWithConfig(pointContainer, true), *mainResult};
+        };
+
+        Autotuner autotuner{std::move(valueCounts), Configuration::get().autotuneBudget};
+        autotuner.search(isValid, measure);
+        TestCaseStatistics::appendReport(Configuration::get().printType, autotuner.renderReport());
+    }
+
     TestResult runImpl(TestCaseStatistics &statistics, const ArgumentContainerT &arguments, const std::string &testCaseNameWithConfig) const {
         // Check test filters and arg filters
         if (!matchesWithTestFilter()) {
@@ -9,6 +9,13 @@
 
 #include "framework/configuration.h"
 #include "framework/test_case/test_case_argument_container.h"
+#include "framework/test_case/test_case_statistics.h"
+#include "framework/test_case/test_isolation.h"
+#include "framework/test_case/test_shard.h"
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
 
 bool TestCaseBase::parseArguments(TestCaseArgumentContainer &arguments, CommandLineArguments &commandLineArguments) {
     arguments.isSingleTestMode = true;
@@ -20,6 +27,90 @@ bool TestCaseBase::parseArguments(TestCaseArgumentContainer &arguments, CommandL
     return true;
 }
 
+bool TestCaseBase::getSweptArguments(const ArgumentContainer &arguments, const CommandLineArguments &commandLineArguments, std::vector<SweptArgument> &outSweptArguments) {
+    outSweptArguments.clear();
+    for (size_t index = 0; index < commandLineArguments.size(); index++) {
+        const CommandLineArgument &commandLineArgument = commandLineArguments[index];
+        for (const Argument *argument : arguments.getArguments()) {
+            if (!commandLineArgument.isKeyEqualTo(argument->getKey())) {
+                continue;
+            }
+
+            SweptArgument sweptArgument{index, {}};
+            if (!argument->getSweepValues(commandLineArgument.getValue(), sweptArgument.values)) {
+                std::cerr << "Invalid list or range of values for --" << commandLineArgument.getKey() << ": " << commandLineArgument.getValue() << '\n';
+                return false;
+            }
+            if (sweptArgument.values.size() > 1 || sweptArgument.values[0] != commandLineArgument.getValue()) {
+                outSweptArguments.push_back(std::move(sweptArgument));
+            }
+        }
+    }
+    return true;
+}
+
+CommandLineArguments TestCaseBase::getSweepPoint(const CommandLineArguments &commandLineArguments, const std::vector<SweptArgument> &sweptArguments, const std::vector<size_t> &point) {
+    CommandLineArguments result{};
+    for (const CommandLineArgument &commandLineArgument : commandLineArguments) {
+        result.push_back(commandLineArgument.withValue(commandLineArgument.getValue()));
+    }
+    for (size_t sweptIndex = 0; sweptIndex < sweptArguments.size(); sweptIndex++) {
+        const SweptArgument &sweptArgument = sweptArguments[sweptIndex];
+        CommandLineArgument &commandLineArgument = result[sweptArgument.commandLineArgumentIndex];
+        commandLineArgument = commandLineArgument.withValue(sweptArgument.values[point[sweptIndex]]);
+    }
+    return result;
+}
+
+bool TestCaseBase::selectNextSweepPoint(const std::vector<SweptArgument> &sweptArguments, std::vector<size_t> &point) {
+    for (size_t sweptIndex = sweptArguments.size(); sweptIndex > 0; sweptIndex--) {
+        if (++point[sweptIndex - 1] < sweptArguments[sweptIndex - 1].values.size()) {
+            return true;
+        }
+        point[sweptIndex - 1] = 0;
+    }
+    return false;
+}
+
+bool TestCaseBase::prepareAutotune(const CommandLineArguments &commandLineArguments, const std::vector<SweptArgument> &sweptArguments, Api &outApi) const {
+    std::vector<std::string> tunedKeys{};
+    for (const std::string &names : Configuration::get().autotune.get()) {
+        std::istringstream namesStream(names);
+        for (std::string name; std::getline(namesStream, name, ',');) {
+            if (!name.empty()) {
+                tunedKeys.push_back(name);
+            }
+        }
+    }
+
+    bool error = false;
+    for (const std::string &key : tunedKeys) {
+        const auto isTuned = [&](const SweptArgument &swept) { return commandLineArguments[swept.commandLineArgumentIndex].isKeyEqualTo(key); };
+        if (std::none_of(sweptArguments.begin(), sweptArguments.end(), isTuned)) {
+            std::cerr << "--autotune: --" << key << " is not an argument of the test given a list or range of values\n";
+            error = true;
+        }
+    }
+    for (const SweptArgument &swept : sweptArguments) {
+        const std::string &key = commandLineArguments[swept.commandLineArgumentIndex].getKey();
+        if (std::find(tunedKeys.begin(), tunedKeys.end(), key) == tunedKeys.end()) {
+            std::cerr << "--autotune: --" << key << " is given a list or range of values, but it is not tuned\n";
+            error = true;
+        }
+    }
+
+    // Results of different APIs are not compared
+    const std::vector<Api> apis = getApisWithImplementation();
+    outApi = Configuration::get().selectedApi;
+    if (outApi == Api::All && apis.size() == 1) {
+        outApi = apis[0];
+    } else if (outApi == Api::All) {
+        std::cerr << "--autotune: the test is implemented for more than one API, select one with --api\n";
+        error = true;
+    }
+    return !error;
+}
+
 std::vector<Api> TestCaseBase::getApisWithImplementation() const {
     std::vector<Api> apis = {};
     for (int apiIndex = static_cast<int>(Api::FIRST); apiIndex <= static_cast<int>(Api::LAST); apiIndex++) {
@@ -98,6 +189,36 @@ bool TestCaseBase::needsToBeFilteredDueToLimitedTargets() const {
     return false;
 }
 
+bool TestCaseBase::isSelectedByFilters(const TestCaseArgumentContainer &arguments) const {
+    if (!matchesWithTestFilter() || !matchesWithArgFilter(arguments) || needsToBeFilteredDueToLimitedTargets()) {
+        return false;
+    }
+    const auto selectedApi = Configuration::get().selectedApi;
+    return arguments.api == selectedApi || selectedApi == Api::All;
+}
+
+bool TestCaseBase::isRunByThisShard(const TestCaseArgumentContainer &arguments) const {
+    // Tests rejected by the filters are not numbered, they are reported as filtered out as usual
+    if (!Configuration::get().shard.isSet() || !isSelectedByFilters(arguments)) {
+        return true;
+    }
+    return TestShard::claimNextTest(mustRunAlone());
+}
+
+void TestCaseBase::runInSeparateProcess(const TestCaseArgumentContainer &arguments) const {
+    std::string errorReason{};
+    if (TestIsolation::runTest(getTestCaseName(), arguments, errorReason) == TestResult::Success) {
+        return;
+    }
+
+    // Reported like an error returned by the test, with the reason in place of its results
+    const auto testCaseNameWithConfig = getTestCaseNameWithConfig(arguments, Configuration::get().dumpCommandLines);
+    ADD_FAILURE() << testCaseNameWithConfig << " " << errorReason;
+    const TestCaseStatistics statistics{1, Configuration::get().printType, false};
+    statistics.printStatisticsString(testCaseNameWithConfig, TestResultHelper::getTestResultInfo(TestResult::Error).stringMessage + " (" + errorReason + ")");
+    statistics.writeJsonResult(getTestCaseName(), testCaseNameWithConfig, arguments, TestResult::Error);
+}
+
 void TestCaseBase::printTestMapWarning() const {
     static bool printed = false;
     if (printed) {
@@ -10,6 +10,7 @@
 #include "framework/enum/api.h"
 #include "framework/test_case/test_case_interface.h"
 
+struct ArgumentContainer;
 struct TestCaseArgumentContainer;
 
 // This class implements test-agnostic functionality of the TestCase class. All methods, which do not require
@@ -17,6 +18,19 @@ struct TestCaseArgumentContainer;
 class TestCaseBase : public TestCaseInterface {
   protected:
     static bool parseArguments(TestCaseArgumentContainer &arguments, CommandLineArguments &commandLineArguments);
+
+    // Sweeps in single-test mode. Each point of the cartesian product of all swept arguments is a separate
+    // run, with the last swept argument changing the fastest.
+    struct SweptArgument {
+        size_t commandLineArgumentIndex;
+        std::vector<std::string> values;
+    };
+    static bool getSweptArguments(const ArgumentContainer &arguments, const CommandLineArguments &commandLineArguments, std::vector<SweptArgument> &outSweptArguments);
+    static CommandLineArguments getSweepPoint(const CommandLineArguments &commandLineArguments, const std::vector<SweptArgument> &sweptArguments, const std::vector<size_t> &point);
+    static bool selectNextSweepPoint(const std::vector<SweptArgument> &sweptArguments, std::vector<size_t> &point);
+
+    // With --autotune, checks that the tuned arguments are the swept ones and selects the API to tune
+    bool prepareAutotune(const CommandLineArguments &commandLineArguments, const std::vector<SweptArgument> &sweptArguments, Api &outApi) const;
     std::vector<Api> getApisWithImplementation() const override;
     std::string getTestCaseNameWithConfig(const TestCaseArgumentContainer &arguments, bool commandLine) const;
 
@@ -24,6 +38,11 @@ class TestCaseBase : public TestCaseInterface {
     bool matchesWithTestFilter() const;
     bool matchesWithArgFilter(const ArgumentContainer &arguments) const;
     bool needsToBeFilteredDueToLimitedTargets() const;
+    bool isSelectedByFilters(const TestCaseArgumentContainer &arguments) const;
+    bool isRunByThisShard(const TestCaseArgumentContainer &arguments) const;
+
+    // With --isolate
+    void runInSeparateProcess(const TestCaseArgumentContainer &arguments) const;
 
     // Warnings
     void printTestMapWarning() const;
@@ -23,4 +23,8 @@ struct TestCaseInterface {
     virtual std::string getHelp() const = 0;
     virtual std::string getHelpParameters() const = 0;
     virtual std::string getTestCaseName() const = 0;
+
+    // Tests which disturb or are disturbed by tests in other processes, e.g. because they spawn
+    // processes on several tiles, are not split between shards. They all run in --shard=alone.
+    virtual bool mustRunAlone() const { return false; }
 };
@@ -9,25 +9,52 @@
 
 #include "framework/argument/abstract/argument.h"
 #include "framework/benchmark_info.h"
+#include "framework/test_case/baseline_comparison.h"
+#include "framework/test_case/steady_state_detector.h"
+#include "framework/test_case/test_case_argument_container.h"
+#include "framework/test_case/test_shard.h"
 #include "framework/test_map.h"
+#include "framework/utility/api_call_statistics.h"
 #include "framework/utility/error.h"
+#include "framework/utility/file_helper.h"
+#include "framework/utility/json_helper.h"
+#include "framework/utility/os_noise_monitor.h"
+#include "framework/utility/trace_recorder.h"
 
 #include <algorithm>
-#include <array>
 #include <chrono>
 #include <cmath>
-#include <cstring>
 #include <ctime>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <numeric>
 #include <sstream>
 #include <type_traits>
 
-TestCaseStatistics::TestCaseStatistics(size_t maxSamplesCount, Configuration::PrintType printType)
+TestCaseStatistics::TestCaseStatistics(size_t maxSamplesCount, Configuration::PrintType printType, bool withRunMeasurements)
     : Statistics(maxSamplesCount),
-      printType(printType) {
+      printType(printType),
+      streaming(Configuration::get().streamingStatistics),
+      recordTimeline(withRunMeasurements && !static_cast<const std::string &>(Configuration::get().timelineOutput).empty()),
+      targetRelativeError(Configuration::get().targetRelativeError),
+      measureCpuTime(withRunMeasurements && Configuration::get().measureCpuTime),
+      monitorOsNoise(withRunMeasurements && OsNoiseMonitor::isEnabled()),
+      dropPreemptedSamples(withRunMeasurements && Configuration::get().dropPreemptedSamples) {
+    if (withRunMeasurements && Configuration::get().measureHostPower) {
+        hostPowerMeter = std::make_unique<HostPowerMeter>();
+        if (!hostPowerMeter->isEnabled()) {
+            hostPowerMeter.reset();
+        } else {
+            hostPowerMeter->measureStart();
+        }
+    }
+    if (measureCpuTime) {
+        testCpuTimer.measureStart();
+        testStart = Clock::now();
+    }
+    startIntervalMeasurements();
 }
 
 void TestCaseStatistics::pushPercentage(double value, MeasurementUnit unit, MeasurementType type, std::string_view description) {
@@ -116,6 +143,15 @@ void TestCaseStatistics::pushCpuCounter(uint64_t count, MeasurementUnit unit, Me
     }
 }
 
+void TestCaseStatistics::pushRatio(double value, MeasurementUnit unit, MeasurementType type, std::string_view description) {
+    if (unit != MeasurementUnit::Ratio) {
+        FATAL_ERROR("Incorrect measurement unit");
+    }
+
+    const Value ratio = value;
+    this->pushValue(ratio, description, unit, type);
+}
+
 void TestCaseStatistics::pushEnergy(size_t microJoules, MeasurementUnit unit, MeasurementType type, std::string_view description) {
     switch (unit) {
     case MeasurementUnit::MicroJoules: {
@@ -149,23 +185,205 @@ void TestCaseStatistics::pushUnitAndType(MeasurementUnit unit, MeasurementType t
 
 bool TestCaseStatistics::isEmpty() const {
     for (auto &samplesEntry : samplesMap) {
-        if (samplesEntry.second.vector.size() != 0) {
+        if (samplesEntry.second.count != 0) {
             return false;
         }
     }
     return true;
 }
 
+std::optional<TestCaseStatistics::MainResult> TestCaseStatistics::getMainResult() const {
+    for (const auto &[samplesName, samples] : samplesMap) {
+        if (isPushedByBenchmark(samples) && samples.count != 0) {
+            const Metrics metrics = samples.histogram ? Metrics{*samples.histogram, Configuration::get().trimOutliers, {}}
+                                                      : Metrics{samples.vector, getIterationsToSkip(samples), Configuration::get().trimOutliers, {}};
+            return MainResult{metrics.median, samples.unit};
+        }
+    }
+    return std::nullopt;
+}
+
 bool TestCaseStatistics::isFull() const {
     DEVELOPER_WARNING_IF(samplesMap.size() == 0, "Test did not generate any values");
     for (auto &samplesEntry : samplesMap) {
-        if (samplesEntry.second.vector.size() != maxSamplesCount) {
+        if (isPushedByBenchmark(samplesEntry.second) && samplesEntry.second.count != maxSamplesCount) {
             return false;
         }
     }
     return true;
 }
 
+bool TestCaseStatistics::needsMoreSamples() const {
+    if (samplesMap.empty()) {
+        return true;
+    }
+
+    size_t leastSamples = maxSamplesCount;
+    for (auto &samplesEntry : samplesMap) {
+        if (!isPushedByBenchmark(samplesEntry.second)) {
+            continue;
+        }
+        if (samplesEntry.second.count >= maxSamplesCount) {
+            return false;
+        }
+        leastSamples = std::min(leastSamples, samplesEntry.second.count);
+    }
+    if (targetRelativeError <= 0) {
+        return true;
+    }
+
+    if (leastSamples < Configuration::get().warmupIterations + Configuration::get().minIterations) {
+        return true;
+    }
+
+    // Checking precision needs a sort, so do it again only after the sample count grew by 10%
+    if (leastSamples >= nextPrecisionCheck) {
+        nextPrecisionCheck = leastSamples + std::max<size_t>(1, leastSamples / 10);
+        reachedTargetPrecision = std::all_of(samplesMap.begin(), samplesMap.end(),
+                                             [this](const auto &samplesEntry) { return isMedianPreciseEnough(samplesEntry.second); });
+    }
+    return !reachedTargetPrecision;
+}
+
+void TestCaseStatistics::startNextBatch() {
+    batchWarmupToDrop = Configuration::get().warmupIterations;
+    for (auto &samplesEntry : samplesMap) {
+        samplesEntry.second.warmupToDrop = batchWarmupToDrop;
+    }
+    startIntervalMeasurements();
+}
+
+size_t TestCaseStatistics::getNextBatchSize() const {
+    // Double the sample count with each batch, so only a few batches are needed
+    size_t mostSamples = 0;
+    for (auto &samplesEntry : samplesMap) {
+        mostSamples = std::max(mostSamples, samplesEntry.second.count);
+    }
+    const size_t remaining = maxSamplesCount > mostSamples ? maxSamplesCount - mostSamples : 0;
+    return std::min(remaining, std::max<size_t>(mostSamples, 1));
+}
+
+void TestCaseStatistics::startIntervalMeasurements() {
+    if (measureCpuTime) {
+        processCpuTimer.measureStart();
+        intervalStart = Clock::now();
+    }
+}
+
+void TestCaseStatistics::endIteration() {
+    iterationsMarked = true;
+    if (measureCpuTime) {
+        pushCpuUtilization();
+    }
+    startIntervalMeasurements();
+    if (monitorOsNoise) {
+        preemptedIterations += OsNoiseMonitor::consumePreemption();
+    }
+}
+
+void TestCaseStatistics::finishMeasurements() {
+    // Without marked iterations cpu utilization is only known for the whole test, setup included
+    if (measureCpuTime && !iterationsMarked) {
+        testCpuTimer.measureEnd();
+        const Value wallSeconds = std::chrono::duration<Value>(Clock::now() - testStart).count();
+        const Value cpuSeconds = std::chrono::duration<Value>(testCpuTimer.get()).count();
+        appendTestValue("cpu utilization", MeasurementUnit::Percentage, wallSeconds > 0 ? 100 * cpuSeconds / wallSeconds : 0);
+    }
+
+    // RAPL counters advance about once per millisecond, so host power is only measured for the whole test
+    if (hostPowerMeter) {
+        pushHostPower();
+    }
+}
+
+void TestCaseStatistics::appendTestValue(std::string_view description, MeasurementUnit unit, Value value) {
+    Samples &samples = getSamples(description, unit, MeasurementType::Cpu);
+    samples.perTest = true;
+    if (streaming) {
+        if (!samples.histogram) {
+            samples.histogram = std::make_unique<StreamingHistogram>();
+        }
+        samples.histogram->push(value);
+    } else {
+        samples.vector.push_back(value);
+    }
+    samples.count++;
+}
+
+bool TestCaseStatistics::shouldDropPreempted(const Samples &samples) const {
+    // Warmup values are skipped anyway and at least half of the values are kept, so a noisy machine
+    // cannot empty the statistics. Cpu utilization and host power cover whole intervals and are never dropped.
+    if (!dropPreemptedSamples || !iterationPreempted || !isPushedByBenchmark(samples)) {
+        return false;
+    }
+    return samples.count >= Configuration::get().warmupIterations && 2 * (samples.droppedPreempted + 1) <= samples.count + 1;
+}
+
+void TestCaseStatistics::pushCpuUtilization() {
+    processCpuTimer.measureEnd();
+    const Value wallSeconds = std::chrono::duration<Value>(Clock::now() - intervalStart).count();
+    const Value cpuSeconds = std::chrono::duration<Value>(processCpuTimer.get()).count();
+    appendValue(getIntervalSamples("cpu utilization", MeasurementUnit::Percentage), wallSeconds > 0 ? 100 * cpuSeconds / wallSeconds : 0);
+}
+
+void TestCaseStatistics::pushHostPower() {
+    hostPowerMeter->measureEnd();
+    if (hostPowerMeter->hasPackageEnergy()) {
+        appendTestValue("host package energy", MeasurementUnit::MicroJoules, static_cast<Value>(hostPowerMeter->getPackageEnergy()));
+        appendTestValue("host package power", MeasurementUnit::Watts, hostPowerMeter->getPackagePower());
+    }
+    if (hostPowerMeter->hasCoreEnergy()) {
+        appendTestValue("host core energy", MeasurementUnit::MicroJoules, static_cast<Value>(hostPowerMeter->getCoreEnergy()));
+    }
+    if (hostPowerMeter->hasEffectiveFrequency()) {
+        appendTestValue("host effective frequency", MeasurementUnit::Gigahertz, hostPowerMeter->getEffectiveFrequency());
+    }
+}
+
+bool TestCaseStatistics::isMedianPreciseEnough(const Samples &samples) const {
+    // Distribution-free confidence interval of the median: with 95% confidence it lies between the
+    // order statistics of ranks n/2 -+ 1.96 * sqrt(n) / 2, so no assumption about normality is made.
+    const size_t iterationsToSkip = std::min(samples.vector.size(), static_cast<size_t>(Configuration::get().warmupIterations));
+    const size_t count = samples.histogram ? samples.histogram->getCount() : samples.vector.size() - iterationsToSkip;
+    if (count < 2) {
+        return false;
+    }
+    const double halfWidth = 1.96 * std::sqrt(static_cast<double>(count)) / 2;
+    const double middle = static_cast<double>(count - 1) / 2;
+    const size_t lowerRank = static_cast<size_t>(std::max(0.0, std::floor(middle - halfWidth)));
+    const size_t upperRank = static_cast<size_t>(std::min(static_cast<double>(count - 1), std::ceil(middle + halfWidth)));
+
+    Value lower{}, upper{}, median{};
+    if (samples.histogram) {
+        const double lastRank = static_cast<double>(count - 1);
+        lower = samples.histogram->getQuantile(static_cast<double>(lowerRank) / lastRank);
+        upper = samples.histogram->getQuantile(static_cast<double>(upperRank) / lastRank);
+        median = samples.histogram->getQuantile(0.5);
+    } else {
+        SamplesVector sorted(samples.vector.begin() + iterationsToSkip, samples.vector.end());
+        std::sort(sorted.begin(), sorted.end());
+        lower = sorted[lowerRank];
+        upper = sorted[upperRank];
+        median = sorted[count / 2];
+    }
+
+    if (median == 0) {
+        return lower == upper;
+    }
+    return (upper - lower) / 2 <= std::fabs(median) * targetRelativeError / 100;
+}
+
+size_t TestCaseStatistics::getIterationsToSkip(const Samples &samples) {
+    if (samples.perTest) {
+        return 0;
+    }
+    const size_t warmupIterations = std::min(samples.vector.size(), static_cast<size_t>(Configuration::get().warmupIterations));
+    if (!Configuration::get().autoWarmup) {
+        return warmupIterations;
+    }
+    return warmupIterations + SteadyStateDetector::findSteadyStateStart(samples.vector.begin() + warmupIterations, samples.vector.end());
+}
+
 void TestCaseStatistics::overrideMeasurementUnit(MeasurementUnit &unit) {
     if (unit == MeasurementUnit::GigabytesPerSecond && Configuration::get().doNotPrintBandwidth) {
         unit = MeasurementUnit::Microseconds;
@@ -175,18 +393,73 @@ void TestCaseStatistics::overrideMeasurementUnit(MeasurementUnit &unit) {
 void TestCaseStatistics::pushValue(Value value, std::string_view description, MeasurementUnit unit, MeasurementType type) {
     FATAL_ERROR_IF(unit == MeasurementUnit::Unknown, "Concrete MeasurementUnit has to be specified");
     FATAL_ERROR_IF(type == MeasurementType::Unknown, "Concrete MeasurementType has to be specified");
+    appendValue(getSamples(description, unit, type), value);
+}
 
+TestCaseStatistics::MetricHandle TestCaseStatistics::registerMetric(MeasurementUnit unit, MeasurementType type, std::string_view description) {
+    FATAL_ERROR_IF(unit == MeasurementUnit::Unknown, "Concrete MeasurementUnit has to be specified");
+    FATAL_ERROR_IF(type == MeasurementType::Unknown, "Concrete MeasurementType has to be specified");
+    overrideMeasurementUnit(unit);
+
+    RegisteredMetric metric{&getSamples(description, unit, type), 1, false};
+    switch (unit) {
+    case MeasurementUnit::Nanoseconds:
+    case MeasurementUnit::Latency:
+        metric.scale = 1e9;
+        break;
+    case MeasurementUnit::Microseconds:
+        metric.scale = 1e6;
+        break;
+    case MeasurementUnit::GigabytesPerSecond:
+    case MeasurementUnit::GigaFLOPS:
+        metric.scale = 1e-9; // Bytes/Nanoseconds = Gigabytes/Seconds
+        metric.needsSize = true;
+        break;
+    case MeasurementUnit::Percentage:
+        break;
+    default:
+        FATAL_ERROR("Measurement unit ", std::to_string(unit), " cannot be used with registered metrics");
+    }
+
+    registeredMetrics.push_back(metric);
+    return registeredMetrics.size() - 1;
+}
+
+void TestCaseStatistics::pushValue(MetricHandle metric, Clock::duration time) {
+    const RegisteredMetric &registeredMetric = registeredMetrics[metric];
+    FATAL_ERROR_IF(registeredMetric.needsSize, "Buffer size needs to be passed when unit is ", std::to_string(registeredMetric.samples->unit));
+    appendValue(*registeredMetric.samples, std::chrono::duration<Value>(time).count() * registeredMetric.scale);
+}
+
+void TestCaseStatistics::pushValue(MetricHandle metric, Clock::duration time, uint64_t size) {
+    const RegisteredMetric &registeredMetric = registeredMetrics[metric];
+    const Value timeSeconds = std::chrono::duration<Value>(time).count();
+    if (registeredMetric.needsSize) {
+        appendValue(*registeredMetric.samples, static_cast<Value>(size) / timeSeconds * registeredMetric.scale);
+    } else {
+        // Bandwidth turned into time with --doNotPrintBandwidth
+        appendValue(*registeredMetric.samples, timeSeconds * registeredMetric.scale);
+    }
+}
+
+void TestCaseStatistics::pushPercentage(MetricHandle metric, double value) {
+    const RegisteredMetric &registeredMetric = registeredMetrics[metric];
+    FATAL_ERROR_IF(registeredMetric.samples->unit != MeasurementUnit::Percentage, "Incorrect measurement unit");
+    appendValue(*registeredMetric.samples, value);
+}
+
+TestCaseStatistics::Samples &TestCaseStatistics::getSamples(std::string_view description, MeasurementUnit unit, MeasurementType type) {
     // avoid creating string for lookup
     auto it = this->samplesMap.find(description);
     if (it == this->samplesMap.end()) {
         it = this->samplesMap.emplace(std::string(description), Samples{}).first;
+        it->second.warmupToDrop = batchWarmupToDrop;
+        if (!streaming) {
+            it->second.vector.reserve(maxSamplesCount);
+        }
     }
     auto &samples = it->second;
 
-    // We expect a precise amount of measurements requested by the user.
-    FATAL_ERROR_IF(samples.vector.size() == maxSamplesCount, "Too many values pushed by the test");
-    samples.vector.reserve(maxSamplesCount);
-
     // Set unit and type for the samples
     if (samples.unit != unit) {
         FATAL_ERROR_IF(samples.unit != MeasurementUnit::Unknown, "Different units used for the same measurement");
@@ -196,8 +469,53 @@ void TestCaseStatistics::pushValue(Value value, std::string_view description, Me
         FATAL_ERROR_IF(samples.type != MeasurementType::Unknown, "Different types used for the same measurement");
         samples.type = type;
     }
+    return samples;
+}
+
+TestCaseStatistics::Samples &TestCaseStatistics::getIntervalSamples(std::string_view description, MeasurementUnit unit) {
+    Samples &samples = getSamples(description, unit, MeasurementType::Cpu);
+    samples.perInterval = true;
+    return samples;
+}
+
+void TestCaseStatistics::appendValue(Samples &samples, Value value) {
+    if (monitorOsNoise && iterationsMarked && isPushedByBenchmark(samples)) {
+        // Regions measured so far in this iteration, it ends with the next endIteration call
+        iterationPreempted = OsNoiseMonitor::isPreemptionPending();
+    }
+
+    if (samples.warmupToDrop > 0) {
+        samples.warmupToDrop--;
+        return;
+    }
+
+    // We expect a precise amount of measurements requested by the user.
+    FATAL_ERROR_IF(samples.count == maxSamplesCount, "Too many values pushed by the test");
+
+    if (shouldDropPreempted(samples)) {
+        samples.droppedPreempted++;
+        samples.count++;
+        droppedValues++;
+        return;
+    }
+
+    if (streaming) {
+        // The sketch cannot forget values, so warmup iterations are dropped before they reach it
+        if (!samples.histogram) {
+            samples.histogram = std::make_unique<StreamingHistogram>();
+        }
+        if (samples.count >= Configuration::get().warmupIterations) {
+            samples.histogram->push(value);
+        }
+    } else {
+        samples.vector.push_back(value);
+    }
+    if (recordTimeline) {
+        const auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch());
+        samples.timeline.push_back({static_cast<uint64_t>(timestamp.count()), samples.count, value});
+    }
+    samples.count++;
 
-    samples.vector.push_back(value);
     if (value >= std::numeric_limits<double>::max()) {
         this->reachedInfinity = true;
     }
@@ -205,28 +523,49 @@ void TestCaseStatistics::pushValue(Value value, std::string_view description, Me
 
 struct ColumnInfo {
     int width;
-    const char *label;
+    std::string label;
 
-    using Columns = std::array<ColumnInfo, 8>;
+    using Columns = std::vector<ColumnInfo>;
 
+    // Percentile columns selected with --percentiles, baseline comparison columns added by
+    // --baseline and the discarded warmup column of --autoWarmup are placed between Max and Type
     static Columns getColumns() {
-        return {{
+        Columns columns = {
             {100, "TestCase"},
             {15, "Mean"},
             {15, "Median"},
             {15, "StdDev"},
             {15, "Min"},
             {15, "Max"},
-            {7, "Type"},
-            {15, "Label [unit]"},
-        }};
+        };
+        for (const double percentile : Configuration::get().percentiles.get()) {
+            columns.push_back({15, "P" + PercentileListArgument::toPercentileString(percentile)});
+        }
+        if (!static_cast<const std::string &>(Configuration::get().baseline).empty()) {
+            columns.push_back({15, "vs Baseline"});
+            columns.push_back({10, "p-value"});
+            columns.push_back({13, "Verdict"});
+        }
+        if (Configuration::get().autoWarmup) {
+            columns.push_back({11, "Discarded"});
+        }
+        columns.push_back({7, "Type"});
+        columns.push_back({15, "Label [unit]"});
+        return columns;
     }
 };
 
 std::vector<TestCaseStatistics::BufferedLine> TestCaseStatistics::testResults;
-std::vector<std::string> TestCaseStatistics::histograms;
+std::vector<std::string> TestCaseStatistics::reports;
 int TestCaseStatistics::lastTransientLineWidth = 0;
 std::string TestCaseStatistics::deviceInfo;
+bool TestCaseStatistics::jsonOutputCreated = false;
+bool TestCaseStatistics::timelineOutputCreated = false;
+bool TestCaseStatistics::htmlOutputCreated = false;
+bool TestCaseStatistics::mdOutputCreated = false;
+size_t TestCaseStatistics::linesWrittenToFiles = 0;
+bool TestCaseStatistics::headerPrinted = false;
+int TestCaseStatistics::nameColumnWidth = 0;
 
 void TestCaseStatistics::setDeviceInfo(const std::string &info) {
     deviceInfo = info;
@@ -258,7 +597,7 @@ static std::string htmlEscape(const std::string &text) {
 
 // Extract and trim the column at colIndex from a BufferedLine::results string
 // built with fixed-width right-aligned columns. colIndex matches the ColumnInfo
-// index (columns[0] is the name column, columns[1..7] are metric columns).
+// index (columns[0] is the name column, the remaining ones are metric columns).
 static std::string extractColumn(const std::string &results, const ColumnInfo::Columns &columns, size_t colIndex) {
     int offset = 0;
     for (size_t i = 1; i < colIndex; i++) {
@@ -348,6 +687,17 @@ void TestCaseStatistics::printStatistics(const std::string &testCaseName) const
         (printType == Configuration::PrintType::Default || printType == Configuration::PrintType::DefaultWithVerbose)) {
         collectHistograms(testCaseName);
     }
+    if (const size_t topCount = Configuration::get().apiCallStatistics; topCount > 0 &&
+        (printType == Configuration::PrintType::Default || printType == Configuration::PrintType::DefaultWithVerbose)) {
+        std::string report = ApiCallStatistics::renderReport(testCaseName, topCount);
+        if (!report.empty()) {
+            reports.push_back(std::move(report));
+        }
+    }
+    if (monitorOsNoise &&
+        (printType == Configuration::PrintType::Default || printType == Configuration::PrintType::DefaultWithVerbose)) {
+        reports.push_back(OsNoiseMonitor::renderReport(testCaseName, iterationsMarked, preemptedIterations, droppedValues));
+    }
 }
 
 void TestCaseStatistics::printStatisticsDefault(const std::string &testCaseName) const {
@@ -357,7 +707,11 @@ void TestCaseStatistics::printStatisticsDefault(const std::string &testCaseName)
     for (const auto &samplesEntry : this->samplesMap) {
         const std::string &samplesName = samplesEntry.first;
         const Samples &samples = samplesEntry.second;
-        const MetricsStrings metricsStrings{samplesName, samples, this->reachedInfinity, Configuration::get().warmupIterations, Configuration::get().trimOutliers};
+        if (samples.count == 0) {
+            continue; // registered, but nothing was pushed
+        }
+        const size_t iterationsToSkip = getIterationsToSkip(samples);
+        const MetricsStrings metricsStrings{samplesName, samples, this->reachedInfinity, iterationsToSkip, Configuration::get().trimOutliers, Configuration::get().percentiles};
 
         int column = 1; // skip name column -- handled separately
         std::ostringstream results;
@@ -366,6 +720,15 @@ void TestCaseStatistics::printStatisticsDefault(const std::string &testCaseName)
         results << std::setw(columns[column++].width) << metricsStrings.standardDeviation;
         results << std::setw(columns[column++].width) << metricsStrings.min;
         results << std::setw(columns[column++].width) << metricsStrings.max;
+        for (const auto &percentile : metricsStrings.percentiles) {
+            results << std::setw(columns[column++].width) << percentile;
+        }
+        for (const auto &baselineString : compareWithBaseline(testCaseName, samplesName, samples, metricsStrings.metrics.median)) {
+            results << std::setw(columns[column++].width) << baselineString;
+        }
+        if (Configuration::get().autoWarmup) {
+            results << std::setw(columns[column++].width) << iterationsToSkip;
+        }
         results << std::setw(columns[column++].width) << metricsStrings.type;
         results << ' ' << std::setw(columns[column++].width - 1) << metricsStrings.label;
 
@@ -396,7 +759,11 @@ void TestCaseStatistics::printStatisticsCsv(const std::string &testCaseName) con
     for (const auto &samplesEntry : this->samplesMap) {
         const std::string &samplesName = samplesEntry.first;
         const Samples &samples = samplesEntry.second;
-        const MetricsStrings metricsStrings{samplesName, samples, this->reachedInfinity, Configuration::get().warmupIterations, Configuration::get().trimOutliers};
+        if (samples.count == 0) {
+            continue; // registered, but nothing was pushed
+        }
+        const size_t iterationsToSkip = getIterationsToSkip(samples);
+        const MetricsStrings metricsStrings{samplesName, samples, this->reachedInfinity, iterationsToSkip, Configuration::get().trimOutliers, Configuration::get().percentiles};
 
         std::cout << testCaseName << ",";
         std::cout << metricsStrings.mean << ",";
@@ -404,12 +771,57 @@ void TestCaseStatistics::printStatisticsCsv(const std::string &testCaseName) con
         std::cout << metricsStrings.standardDeviation << ",";
         std::cout << metricsStrings.min << ",";
         std::cout << metricsStrings.max << ",";
+        for (const auto &percentile : metricsStrings.percentiles) {
+            std::cout << percentile << ",";
+        }
+        for (const auto &baselineString : compareWithBaseline(testCaseName, samplesName, samples, metricsStrings.metrics.median)) {
+            std::cout << baselineString << ",";
+        }
+        if (Configuration::get().autoWarmup) {
+            std::cout << iterationsToSkip << ",";
+        }
         std::cout << metricsStrings.type << ",";
         std::cout << metricsStrings.label;
         std::cout << std::endl;
     }
 }
 
+std::vector<std::string> TestCaseStatistics::compareWithBaseline(const std::string &testCaseName, const std::string &samplesName, const Samples &samples, Value median) const {
+    if (!BaselineComparison::isLoaded()) {
+        return {};
+    }
+
+    BaselineComparison::WeightedSamples weightedSamples{};
+    if (samples.histogram) {
+        samples.histogram->forEachBucket([&](Value value, size_t count) { weightedSamples.push_back({value, count}); });
+    } else {
+        const size_t iterationsToSkip = getIterationsToSkip(samples);
+        SamplesVector sorted(samples.vector.begin() + iterationsToSkip, samples.vector.end());
+        std::sort(sorted.begin(), sorted.end());
+        for (const Value value : sorted) {
+            if (weightedSamples.empty() || weightedSamples.back().first != value) {
+                weightedSamples.push_back({value, 0});
+            }
+            weightedSamples.back().second++;
+        }
+    }
+
+    const auto result = BaselineComparison::compare(testCaseName, samplesName, samples.unit, weightedSamples, median);
+    if (result.verdict == BaselineComparison::Verdict::NoBaseline) {
+        return {"-", "-", std::to_string(result.verdict)};
+    }
+
+    std::ostringstream delta{};
+    delta << std::showpos << std::fixed << std::setprecision(2) << result.deltaPercentage << "%";
+    std::ostringstream pValue{};
+    if (std::isnan(result.pValue)) {
+        pValue << "-";
+    } else {
+        pValue << std::fixed << std::setprecision(4) << result.pValue;
+    }
+    return {delta.str(), pValue.str(), std::to_string(result.verdict)};
+}
+
 void TestCaseStatistics::printStatisticsVerbose() const {
     for (const auto &samplesEntry : this->samplesMap) {
         std::ostringstream line;
@@ -431,7 +843,7 @@ void TestCaseStatistics::collectHistograms(const std::string &testCaseName) cons
     for (const auto &samplesEntry : this->samplesMap) {
         std::string histogram = renderHistogram(testCaseName, samplesEntry.first, samplesEntry.second);
         if (!histogram.empty()) {
-            histograms.push_back(std::move(histogram));
+            reports.push_back(std::move(histogram));
         }
     }
 }
@@ -440,7 +852,7 @@ std::string TestCaseStatistics::renderHistogram(const std::string &testCaseName,
     constexpr size_t maxBins = 20;
     constexpr size_t barWidth = 50;
 
-    const size_t skip = std::min(static_cast<size_t>(Configuration::get().warmupIterations), samples.vector.size());
+    const size_t skip = getIterationsToSkip(samples);
     if (skip >= samples.vector.size()) {
         return {};
     }
@@ -635,6 +1047,9 @@ std::string TestCaseStatistics::renderHistogram(const std::string &testCaseName,
     out << "  metric: " << label << "  samples: " << sampleCount
         << "  min: " << formatValue(minValue) << "  median: " << formatValue(median)
         << "  max: " << formatValue(maxValue);
+    if (Configuration::get().autoWarmup) {
+        out << "  discarded: " << skip;
+    }
     if (underflow > 0 || overflow > 0) {
         out << "  (" << (underflow + overflow) << " samples outside the bulk shown as log-scaled tail rows)";
     }
@@ -715,54 +1130,156 @@ void TestCaseStatistics::printStatisticsString(const std::string &testCaseName,
     }
 }
 
+int TestCaseStatistics::getMinNameColumnWidth() {
+    return static_cast<int>(ColumnInfo::getColumns()[0].label.size());
+}
+
+void TestCaseStatistics::flushCompletedResults(Configuration::PrintType printType) {
+    if (testResults.empty() && reports.empty()) {
+        return;
+    }
+
+    // Names of the tests are not known up front, so printed results are held back for alignment, but
+    // only up to a limit. Past it the column width is fixed from what was seen and longer names
+    // overflow it. Result files are written right away. Shard workers print results right away too,
+    // before the marker of the next test, and leave the alignment to the coordinator.
+    writeResultFiles();
+    if (nameColumnWidth == 0) {
+        const bool holdBack = !Configuration::get().shardMarkers && !Configuration::get().isolatedTest;
+        if (holdBack && testResults.size() < maxBufferedLines && reports.size() < maxBufferedReports) {
+            return;
+        }
+        nameColumnWidth = getWidestBufferedName();
+    }
+    writeBufferedLines(printType);
+}
+
 void TestCaseStatistics::flushBufferedResults(Configuration::PrintType printType) {
-    if (testResults.empty()) {
-        histograms.clear();
+    if (!testResults.empty() || !reports.empty()) {
+        if (!headerPrinted) {
+            nameColumnWidth = std::max(nameColumnWidth, getWidestBufferedName());
+        }
+        writeBufferedLines(printType);
+    }
+    reports.clear();
+
+    const std::string &htmlPath = Configuration::get().htmlOutput;
+    if (htmlOutputCreated) {
+        finishHtmlResults(htmlPath);
+    }
+
+    const std::string &mdPath = Configuration::get().mdOutput;
+    if (mdOutputCreated) {
+        finishMdResults(mdPath);
+    }
+
+    TraceRecorder::finishTrace();
+
+    nameColumnWidth = 0;
+    headerPrinted = false;
+    htmlOutputCreated = false;
+    mdOutputCreated = false;
+}
+
+void TestCaseStatistics::appendIsolatedOutput(Configuration::PrintType printType, const std::string &output) {
+    // CSV rows are not held back
+    if (printType == Configuration::PrintType::Csv) {
+        std::cout << output;
         return;
     }
 
-    // Find the longest test case name across all buffered entries, but at least as wide as the header label
-    const auto columns = ColumnInfo::getColumns();
-    int maxNameWidth = static_cast<int>(std::strlen(columns[0].label));
+    // Result lines carry the name followed by a separator, the rest, like reports, is kept as it is
+    std::istringstream stream(output);
+    std::string line;
+    while (std::getline(stream, line)) {
+        if (const size_t carriageReturn = line.find_last_of('\r'); carriageReturn != std::string::npos) {
+            line.erase(0, carriageReturn + 1);
+            if (line.find_first_not_of(' ') == std::string::npos) {
+                continue; // transient line cleared by the process
+            }
+        }
+        if (const size_t separator = line.find(TestShard::nameSeparator); separator != std::string::npos) {
+            testResults.push_back({line.substr(0, separator), line.substr(separator + 1)});
+        } else {
+            testResults.push_back({"", line, true});
+        }
+    }
+}
+
+void TestCaseStatistics::appendReport(Configuration::PrintType printType, std::string report) {
+    if (printType == Configuration::PrintType::Default || printType == Configuration::PrintType::DefaultWithVerbose) {
+        reports.push_back(std::move(report));
+    }
+}
+
+void TestCaseStatistics::appendJsonRecords(const std::string &records) {
+    const std::string &filePath = Configuration::get().jsonOutput;
+    if (filePath.empty() || records.empty()) {
+        return;
+    }
+    if (!FileHelper::appendToFile(filePath, records, !jsonOutputCreated)) {
+        std::cerr << "ERROR: cannot open JSON output file: " << filePath << '\n';
+        return;
+    }
+    jsonOutputCreated = true;
+}
+
+int TestCaseStatistics::getWidestBufferedName() {
+    // At least as wide as the header label
+    int maxNameWidth = getMinNameColumnWidth();
     for (const auto &line : testResults) {
         if (!line.isFullLine) {
             maxNameWidth = std::max(maxNameWidth, static_cast<int>(line.name.size()));
         }
     }
+    return maxNameWidth;
+}
 
-    if (!Configuration::get().noColumnNames) {
-        printStatisticsHeader(printType, maxNameWidth);
+void TestCaseStatistics::writeBufferedLines(Configuration::PrintType printType) {
+    if (!testResults.empty() && !headerPrinted) {
+        if (!Configuration::get().noColumnNames) {
+            printStatisticsHeader(printType, nameColumnWidth);
+        }
+        headerPrinted = true;
     }
 
     for (const auto &line : testResults) {
         if (line.isFullLine) {
             std::cout << line.results << '\n';
+        } else if (Configuration::get().shardMarkers || Configuration::get().isolatedTest) {
+            std::cout << line.name << TestShard::nameSeparator << line.results << '\n';
         } else {
-            std::cout << std::setw(maxNameWidth) << std::left << line.name << std::right << line.results << '\n';
+            std::cout << std::setw(nameColumnWidth) << std::left << line.name << std::right << line.results << '\n';
         }
     }
+
+    for (const auto &report : reports) {
+        std::cout << '\n'
+                  << report << '\n';
+    }
     std::cout.flush();
+    reports.clear();
 
-    if (!histograms.empty()) {
-        std::cout << '\n';
-        for (const auto &histogram : histograms) {
-            std::cout << histogram << '\n';
-        }
-        std::cout.flush();
-        histograms.clear();
+    writeResultFiles();
+    testResults.clear();
+    linesWrittenToFiles = 0;
+}
+
+void TestCaseStatistics::writeResultFiles() {
+    if (linesWrittenToFiles == testResults.size()) {
+        return;
     }
 
     const std::string &htmlPath = Configuration::get().htmlOutput;
     if (!htmlPath.empty()) {
-        writeHtmlResults(htmlPath);
+        appendHtmlResults(htmlPath);
     }
 
     const std::string &mdPath = Configuration::get().mdOutput;
     if (!mdPath.empty()) {
-        writeMdResults(mdPath);
+        appendMdResults(mdPath);
     }
-
-    testResults.clear();
+    linesWrittenToFiles = testResults.size();
 }
 
 static std::string currentTimestamp() {
@@ -778,13 +1295,9 @@ static std::string currentTimestamp() {
     return timestamp.str();
 }
 
-void TestCaseStatistics::writeHtmlResults(const std::string &filePath) {
-    std::ofstream htmlFile(filePath);
-    if (!htmlFile) {
-        std::cerr << "ERROR: cannot open HTML output file: " << filePath << '\n';
-        return;
-    }
-
+// HTML and Markdown files get their header with the first results and their test descriptions
+// at the end of the run. Rows are appended as tests finish, so a crash keeps everything up to it.
+static void writeHtmlHeader(std::ostream &htmlFile, const ColumnInfo::Columns &columns, const std::string &deviceInfo) {
     const std::string benchmarkName = BenchmarkInfo::get().getBenchmarkName();
     const auto &cfg = Configuration::get();
 
@@ -812,15 +1325,23 @@ void TestCaseStatistics::writeHtmlResults(const std::string &filePath) {
                  << "</pre>\n";
     }
 
-    const auto columns = ColumnInfo::getColumns();
-
     htmlFile << "<table>\n<thead><tr>";
     for (const auto &col : columns) {
         htmlFile << "<th>" << col.label << "</th>";
     }
     htmlFile << "</tr></thead>\n<tbody>\n";
+}
 
-    for (const auto &line : testResults) {
+void TestCaseStatistics::appendHtmlResults(const std::string &filePath) {
+    const auto columns = ColumnInfo::getColumns();
+    std::ostringstream htmlFile;
+
+    if (!htmlOutputCreated) {
+        writeHtmlHeader(htmlFile, columns, deviceInfo);
+    }
+
+    for (auto lineIt = testResults.begin() + linesWrittenToFiles; lineIt != testResults.end(); ++lineIt) {
+        const BufferedLine &line = *lineIt;
         if (line.isFullLine) {
             continue;
         }
@@ -831,6 +1352,15 @@ void TestCaseStatistics::writeHtmlResults(const std::string &filePath) {
         htmlFile << "</tr>\n";
     }
 
+    if (!FileHelper::appendToFile(filePath, htmlFile.str(), !htmlOutputCreated)) {
+        std::cerr << "ERROR: cannot open HTML output file: " << filePath << '\n';
+        return;
+    }
+    htmlOutputCreated = true;
+}
+
+void TestCaseStatistics::finishHtmlResults(const std::string &filePath) {
+    std::ostringstream htmlFile;
     htmlFile << "</tbody>\n</table>\n";
 
     htmlFile << "<h2>Test Descriptions</h2>\n";
@@ -854,15 +1384,13 @@ void TestCaseStatistics::writeHtmlResults(const std::string &filePath) {
     }
 
     htmlFile << "</body>\n</html>\n";
-}
 
-void TestCaseStatistics::writeMdResults(const std::string &filePath) {
-    std::ofstream mdFile(filePath);
-    if (!mdFile) {
-        std::cerr << "ERROR: cannot open Markdown output file: " << filePath << '\n';
-        return;
+    if (!FileHelper::appendToFile(filePath, htmlFile.str())) {
+        std::cerr << "ERROR: cannot open HTML output file: " << filePath << '\n';
     }
+}
 
+static void writeMdHeader(std::ostream &mdFile, const ColumnInfo::Columns &columns, const std::string &deviceInfo) {
     const std::string benchmarkName = BenchmarkInfo::get().getBenchmarkName();
     const auto &cfg = Configuration::get();
 
@@ -876,8 +1404,6 @@ void TestCaseStatistics::writeMdResults(const std::string &filePath) {
                << deviceInfo << "```\n\n";
     }
 
-    const auto columns = ColumnInfo::getColumns();
-
     for (const auto &col : columns) {
         mdFile << "| " << col.label << " ";
     }
@@ -886,8 +1412,18 @@ void TestCaseStatistics::writeMdResults(const std::string &filePath) {
         mdFile << "|---";
     }
     mdFile << "|\n";
+}
 
-    for (const auto &line : testResults) {
+void TestCaseStatistics::appendMdResults(const std::string &filePath) {
+    const auto columns = ColumnInfo::getColumns();
+    std::ostringstream mdFile;
+
+    if (!mdOutputCreated) {
+        writeMdHeader(mdFile, columns, deviceInfo);
+    }
+
+    for (auto lineIt = testResults.begin() + linesWrittenToFiles; lineIt != testResults.end(); ++lineIt) {
+        const BufferedLine &line = *lineIt;
         if (line.isFullLine) {
             continue;
         }
@@ -898,6 +1434,15 @@ void TestCaseStatistics::writeMdResults(const std::string &filePath) {
         mdFile << " |\n";
     }
 
+    if (!FileHelper::appendToFile(filePath, mdFile.str(), !mdOutputCreated)) {
+        std::cerr << "ERROR: cannot open Markdown output file: " << filePath << '\n';
+        return;
+    }
+    mdOutputCreated = true;
+}
+
+void TestCaseStatistics::finishMdResults(const std::string &filePath) {
+    std::ostringstream mdFile;
     mdFile << "\n## Test Descriptions\n";
     for (const auto &entry : TestMap::get()) {
         const TestCaseInterface &testCase = *entry.second;
@@ -915,9 +1460,141 @@ void TestCaseStatistics::writeMdResults(const std::string &filePath) {
             }
         }
     }
+
+    if (!FileHelper::appendToFile(filePath, mdFile.str())) {
+        std::cerr << "ERROR: cannot open Markdown output file: " << filePath << '\n';
+    }
+}
+
+// Units and types are printed as e.g. "[us]" and "[CPU]", JSON records get them without brackets
+static std::string withoutBrackets(const std::string &text) {
+    if (text.size() >= 2 && text.front() == '[' && text.back() == ']') {
+        return text.substr(1, text.size() - 2);
+    }
+    return text;
+}
+
+void TestCaseStatistics::writeJsonResult(const std::string &testCaseName, const std::string &testCaseNameWithConfig, const TestCaseArgumentContainer &arguments, TestResult testResult) const {
+    const std::string &filePath = Configuration::get().jsonOutput;
+    if (filePath.empty()) {
+        return;
+    }
+
+    const bool success = testResult == TestResult::Success;
+    const std::string status = success ? "SUCCESS" : TestResultHelper::getTestResultInfo(testResult).stringMessage;
+    const size_t warmupIterations = Configuration::get().warmupIterations;
+
+    std::ostringstream record;
+    record << "{\"name\":" << JsonHelper::toString(testCaseNameWithConfig)
+           << ",\"test\":" << JsonHelper::toString(testCaseName)
+           << ",\"benchmark\":" << JsonHelper::toString(BenchmarkInfo::get().getBenchmarkName())
+           << ",\"api\":" << JsonHelper::toString(std::to_string(arguments.api))
+           << ",\"status\":" << JsonHelper::toString(status);
+
+    record << ",\"arguments\":{";
+    const auto &args = arguments.getArguments();
+    for (size_t i = 0; i < args.size(); i++) {
+        record << (i == 0 ? "" : ",") << JsonHelper::toString(args[i]->getKey()) << ":" << JsonHelper::toString(args[i]->getValueString());
+    }
+    record << "}";
+
+    record << ",\"warmupIterations\":" << warmupIterations
+           << ",\"device\":" << JsonHelper::toString(deviceInfo);
+
+    record << ",\"metrics\":[";
+    bool isFirst = true;
+    for (const auto &samplesEntry : this->samplesMap) {
+        const Samples &samples = samplesEntry.second;
+        const size_t iterationsToSkip = getIterationsToSkip(samples);
+        const size_t samplesCount = samples.histogram ? samples.histogram->getCount() : samples.vector.size() - iterationsToSkip;
+        if (!success || samplesCount == 0) {
+            continue;
+        }
+        const Metrics metrics = samples.histogram ? Metrics{*samples.histogram, Configuration::get().trimOutliers, Configuration::get().percentiles}
+                                                  : Metrics{samples.vector, iterationsToSkip, Configuration::get().trimOutliers, Configuration::get().percentiles};
+
+        record << (isFirst ? "" : ",") << "{\"label\":" << JsonHelper::toString(samplesEntry.first)
+               << ",\"unit\":" << JsonHelper::toString(withoutBrackets(std::to_string(samples.unit)))
+               << ",\"type\":" << JsonHelper::toString(withoutBrackets(std::to_string(samples.type)))
+               << ",\"samples\":" << samplesCount
+               << ",\"discardedSamples\":" << iterationsToSkip
+               << ",\"mean\":" << JsonHelper::toNumber(this->reachedInfinity ? std::numeric_limits<Value>::infinity() : metrics.mean)
+               << ",\"median\":" << JsonHelper::toNumber(metrics.median)
+               << ",\"stdDevRelative\":" << JsonHelper::toNumber(this->reachedInfinity ? std::numeric_limits<Value>::infinity() : metrics.standardDeviation)
+               << ",\"min\":" << JsonHelper::toNumber(metrics.min)
+               << ",\"max\":" << JsonHelper::toNumber(metrics.max);
+        record << ",\"percentiles\":{";
+        const std::vector<double> &percentiles = Configuration::get().percentiles;
+        for (size_t i = 0; i < percentiles.size(); i++) {
+            record << (i == 0 ? "" : ",") << JsonHelper::toString(PercentileListArgument::toPercentileString(percentiles[i])) << ":" << JsonHelper::toNumber(metrics.percentiles[i]);
+        }
+        record << "}";
+        if (Configuration::get().jsonRawSamples && !samples.histogram) {
+            record << ",\"rawSamples\":[";
+            for (size_t i = iterationsToSkip; i < samples.vector.size(); i++) {
+                record << (i == iterationsToSkip ? "" : ",") << JsonHelper::toNumber(samples.vector[i]);
+            }
+            record << "]";
+        }
+        record << "}";
+        isFirst = false;
+    }
+    record << "]}\n";
+
+    // The file is truncated by the first record of the run and appended to afterwards, so records
+    // of finished tests are on disk even if a later test crashes
+    if (!FileHelper::appendToFile(filePath, record.str(), !jsonOutputCreated)) {
+        std::cerr << "ERROR: cannot open JSON output file: " << filePath << '\n';
+        return;
+    }
+    jsonOutputCreated = true;
+}
+
+// Test names contain spaces and labels are free text, so both are always quoted
+static std::string csvQuote(const std::string &text) {
+    std::string quoted = "\"";
+    for (const char c : text) {
+        quoted += c;
+        if (c == '"') {
+            quoted += '"';
+        }
+    }
+    return quoted + '"';
+}
+
+void TestCaseStatistics::writeTimeline(const std::string &testCaseName) const {
+    const std::string &filePath = Configuration::get().timelineOutput;
+    if (filePath.empty()) {
+        return;
+    }
+
+    // Same as JSON output, the file is truncated by the first test and appended to afterwards
+    std::ostringstream timelineFile;
+    if (!timelineOutputCreated) {
+        timelineFile << "TestCase,Label,Unit,Type,Iteration,Warmup,TimestampNs,Value\n";
+    }
+
+    const std::string quotedName = csvQuote(testCaseName);
+    const size_t warmupIterations = Configuration::get().warmupIterations;
+    for (const auto &samplesEntry : this->samplesMap) {
+        const Samples &samples = samplesEntry.second;
+        const std::string unit = withoutBrackets(std::to_string(samples.unit));
+        const std::string type = withoutBrackets(std::to_string(samples.type));
+        for (const TimelineEntry &entry : samples.timeline) {
+            timelineFile << quotedName << ',' << csvQuote(samplesEntry.first) << ',' << unit << ',' << type << ','
+                         << entry.iteration << ',' << (entry.iteration < warmupIterations ? 1 : 0) << ','
+                         << entry.timestampNs << ',' << std::setprecision(10) << entry.value << '\n';
+        }
+    }
+
+    if (!FileHelper::appendToFile(filePath, timelineFile.str(), !timelineOutputCreated)) {
+        std::cerr << "ERROR: cannot open timeline output file: " << filePath << '\n';
+        return;
+    }
+    timelineOutputCreated = true;
 }
 
-TestCaseStatistics::Metrics::Metrics(const SamplesVector &samples, size_t iterationsToSkip, size_t trimPercentage) {
+TestCaseStatistics::Metrics::Metrics(const SamplesVector &samples, size_t iterationsToSkip, size_t trimPercentage, const std::vector<double> &percentilesToCalculate) {
     ConstIter begin, end;
     SamplesVector trimmed;
     if (trimPercentage > 0) {
@@ -928,11 +1605,77 @@ TestCaseStatistics::Metrics::Metrics(const SamplesVector &samples, size_t iterat
         begin = samples.begin() + iterationsToSkip;
         end = samples.end();
     }
+    if (begin == end) {
+        setNoSamples(percentilesToCalculate.size());
+        return;
+    }
     mean = calculateMean(begin, end);
     min = calculateMin(begin, end);
     max = calculateMax(begin, end);
-    median = calculateMedian(begin, end);
     standardDeviation = calculateStandardDeviation(begin, end, mean);
+
+    SamplesVector sorted(begin, end);
+    std::sort(sorted.begin(), sorted.end());
+    median = calculateMedian(sorted);
+    for (const double percentile : percentilesToCalculate) {
+        percentiles.push_back(calculatePercentile(sorted, percentile));
+    }
+}
+
+TestCaseStatistics::Metrics::Metrics(const StreamingHistogram &histogram, size_t trimPercentage, const std::vector<double> &percentilesToCalculate) {
+    if (histogram.getCount() == 0) {
+        setNoSamples(percentilesToCalculate.size());
+        return;
+    }
+    min = histogram.getMin();
+    max = histogram.getMax();
+    mean = histogram.getMean();
+    median = histogram.getQuantile(0.5);
+    standardDeviation = histogram.getStandardDeviation() / mean;
+    if (trimPercentage == 0) {
+        for (const double percentile : percentilesToCalculate) {
+            percentiles.push_back(histogram.getQuantile(percentile / 100));
+        }
+        return;
+    }
+
+    // Individual samples are not kept, so the trimmed range is rebuilt from bucket values.
+    // Median is not affected, since the same number of samples is trimmed from both ends.
+    const size_t trimCount = histogram.getCount() * trimPercentage / 100;
+    const size_t keepEnd = histogram.getCount() - trimCount;
+    size_t rank = 0;
+    size_t keptCount = 0;
+    Value sum = 0;
+    Value sumOfSquares = 0;
+    histogram.forEachBucket([&](Value value, size_t bucketCount) {
+        const size_t begin = std::max(rank, trimCount);
+        const size_t end = std::min(rank + bucketCount, keepEnd);
+        rank += bucketCount;
+        if (begin >= end) {
+            return;
+        }
+        if (keptCount == 0) {
+            min = value;
+        }
+        max = value;
+        keptCount += end - begin;
+        sum += value * static_cast<Value>(end - begin);
+        sumOfSquares += value * value * static_cast<Value>(end - begin);
+    });
+    mean = sum / static_cast<Value>(keptCount);
+    standardDeviation = std::sqrt(std::max(Value{0}, sumOfSquares / static_cast<Value>(keptCount) - mean * mean)) / mean;
+
+    // Percentiles of the trimmed range, translated to ranks of the whole histogram
+    for (const double percentile : percentilesToCalculate) {
+        const double rank = static_cast<double>(trimCount) + percentile / 100 * static_cast<double>(keptCount - 1);
+        percentiles.push_back(histogram.getQuantile(rank / static_cast<double>(histogram.getCount() - 1)));
+    }
+}
+
+void TestCaseStatistics::Metrics::setNoSamples(size_t percentilesCount) {
+    // All values were warmup, e.g. a metric pushed once per test. Reported as zeros rather than NaN.
+    min = max = mean = median = standardDeviation = 0;
+    percentiles.assign(percentilesCount, 0);
 }
 
 TestCaseStatistics::SamplesVector TestCaseStatistics::Metrics::getTrimmedSamples(const SamplesVector &samples, size_t iterationsToSkip, size_t trimPercentage) {
@@ -956,9 +1699,7 @@ TestCaseStatistics::Value TestCaseStatistics::Metrics::calculateMean(ConstIter b
     return std::accumulate(begin, end, Value{0}) / std::distance(begin, end);
 }
 
-TestCaseStatistics::Value TestCaseStatistics::Metrics::calculateMedian(ConstIter begin, ConstIter end) {
-    SamplesVector sorted(begin, end);
-    std::sort(sorted.begin(), sorted.end());
+TestCaseStatistics::Value TestCaseStatistics::Metrics::calculateMedian(const SamplesVector &sorted) {
     const auto samplesCount = sorted.size();
     if (samplesCount % 2 == 0) {
         return (sorted[samplesCount / 2 - 1] + sorted[samplesCount / 2]) / 2;
@@ -967,6 +1708,20 @@ TestCaseStatistics::Value TestCaseStatistics::Metrics::calculateMedian(ConstIter
     }
 }
 
+TestCaseStatistics::Value TestCaseStatistics::Metrics::calculatePercentile(const SamplesVector &sorted, double percentile) {
+    // Linear interpolation between the two closest ranks, same as in renderHistogram
+    if (sorted.size() == 1) {
+        return sorted.front();
+    }
+    const double position = percentile / 100 * static_cast<double>(sorted.size() - 1);
+    const size_t index = static_cast<size_t>(position);
+    const double fraction = position - static_cast<double>(index);
+    if (index + 1 < sorted.size()) {
+        return sorted[index] + (sorted[index + 1] - sorted[index]) * static_cast<Value>(fraction);
+    }
+    return sorted[index];
+}
+
 TestCaseStatistics::Value TestCaseStatistics::Metrics::calculateStandardDeviation(ConstIter begin, ConstIter end, Value mean) {
     Value diffSum = 0;
     for (auto it = begin; it != end; ++it) {
@@ -980,13 +1735,14 @@ TestCaseStatistics::Value TestCaseStatistics::Metrics::calculateStandardDeviatio
     return stdDev;
 }
 
-TestCaseStatistics::MetricsStrings::MetricsStrings(const std::string &name, const Samples &samples, bool reachedInfinity, size_t iterationsToSkip, size_t trimPercentage)
-    : metrics(samples.vector, iterationsToSkip, trimPercentage),
+TestCaseStatistics::MetricsStrings::MetricsStrings(const std::string &name, const Samples &samples, bool reachedInfinity, size_t iterationsToSkip, size_t trimPercentage, const std::vector<double> &percentilesToCalculate)
+    : metrics(samples.histogram ? Metrics{*samples.histogram, trimPercentage, percentilesToCalculate} : Metrics{samples.vector, iterationsToSkip, trimPercentage, percentilesToCalculate}),
       min(generateMin(metrics.min)),
       max(generateMax(metrics.max)),
       mean(generateMean(metrics.mean, reachedInfinity)),
       median(generateMedian(metrics.median)),
       standardDeviation(generateStandardDeviation(metrics.standardDeviation, reachedInfinity)),
+      percentiles(generatePercentiles(metrics.percentiles)),
       type(std::to_string(samples.type)),
       label(generateLabel(name, samples.unit)) {
 }
@@ -1020,6 +1776,14 @@ std::string TestCaseStatistics::MetricsStrings::generateStandardDeviation(Value
     return result.str();
 }
 
+std::vector<std::string> TestCaseStatistics::MetricsStrings::generatePercentiles(const std::vector<Value> &percentiles) {
+    std::vector<std::string> result{};
+    for (const Value percentile : percentiles) {
+        result.push_back(generate(percentile));
+    }
+    return result;
+}
+
 std::string TestCaseStatistics::MetricsStrings::generate(Value value) {
     std::ostringstream result{};
     result << std::fixed << std::setprecision(3) << value;
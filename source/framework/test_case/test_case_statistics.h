@@ -7,48 +7,106 @@
 
 #pragma once
 #include "framework/configuration.h"
+#include "framework/test_case/streaming_histogram.h"
+#include "framework/test_case/test_result.h"
+#include "framework/utility/cpu_time_timer.h"
+#include "framework/utility/host_power_meter.h"
 #include "framework/utility/statistics.h"
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
 
+struct TestCaseArgumentContainer;
+
 class TestCaseStatistics : public Statistics {
   public:
     using Clock = std::chrono::high_resolution_clock;
     using Value = double;
     using SamplesVector = std::vector<Value>;
+    struct TimelineEntry {
+        uint64_t timestampNs; // steady clock, same time base as std::chrono::steady_clock::now()
+        size_t iteration;     // index of the sample, including warmup
+        Value value;
+    };
     struct Samples {
         MeasurementUnit unit = MeasurementUnit::Unknown;
         MeasurementType type = MeasurementType::Unknown;
         SamplesVector vector = {};
+        std::unique_ptr<StreamingHistogram> histogram = {}; // replaces vector in streaming mode
+        size_t count = 0;                                   // all pushed values, including warmup
+        size_t warmupToDrop = 0;                            // warmup values of the current batch, not stored
+        size_t droppedPreempted = 0;                        // counted, but not stored, with --dropPreemptedSamples
+        bool perInterval = false;                           // pushed by TestCaseStatistics itself at the end of each marked iteration
+        bool perTest = false;                               // one value for the whole test pushed by TestCaseStatistics itself, no warmup
+        std::vector<TimelineEntry> timeline = {};           // only with --timelineOutput
     };
     using SamplesMap = std::map<std::string, Samples, std::less<>>;
+    struct MainResult {
+        Value median;
+        MeasurementUnit unit;
+    };
 
-    explicit TestCaseStatistics(size_t maxSamplesCount, Configuration::PrintType printType);
+    // Without run measurements only the pushed values are kept - cpu time, host power, OS noise and
+    // the timeline are left out, e.g. for statistics created by a benchmark measuring the pushes
+    explicit TestCaseStatistics(size_t maxSamplesCount, Configuration::PrintType printType, bool withRunMeasurements = true);
 
     void pushPercentage(double value, MeasurementUnit unit, MeasurementType type, std::string_view description = "") override;
     void pushValue(Clock::duration time, MeasurementUnit unit, MeasurementType type, std::string_view description = "") override;
     void pushValue(Clock::duration time, uint64_t size, MeasurementUnit unit, MeasurementType type, std::string_view description = "") override;
     void pushCpuCounter(uint64_t count, MeasurementUnit unit, MeasurementType type, std::string_view description = "") override;
+    void pushRatio(double value, MeasurementUnit unit, MeasurementType type, std::string_view description = "") override;
     void pushEnergy(size_t microJoules, MeasurementUnit unit, MeasurementType type, std::string_view description = "") override;
     void pushEnergy(double watts, MeasurementUnit unit, MeasurementType type, std::string_view description = "") override;
     void pushUnitAndType(MeasurementUnit unit, MeasurementType type) override;
+    MetricHandle registerMetric(MeasurementUnit unit, MeasurementType type, std::string_view description = "") override;
+    void pushValue(MetricHandle metric, Clock::duration time) override;
+    void pushValue(MetricHandle metric, Clock::duration time, uint64_t size) override;
+    void pushPercentage(MetricHandle metric, double value) override;
 
     bool isEmpty() const override;
     bool isFull() const override;
+    bool needsMoreSamples() const override;
+    void endIteration() override;
+
+    // Pushes the values measured for the whole test, called once the benchmark finished successfully
+    void finishMeasurements();
+
+    // Median of the first values pushed by the benchmark, compared by --autotune. Empty if nothing was pushed.
+    std::optional<MainResult> getMainResult() const;
+
+    // Used by TestCase::run with --targetRelativeError. Each subsequent batch is a new run of the
+    // benchmark, so its first warmupIterations values are dropped as they are pushed.
+    void startNextBatch();
+    size_t getNextBatchSize() const;
 
     static void printStatisticsHeader(Configuration::PrintType printType, int nameColumnWidth);
+
+    static int getMinNameColumnWidth();
+
+    static void flushCompletedResults(Configuration::PrintType printType);
     static void flushBufferedResults(Configuration::PrintType printType);
-    static void writeHtmlResults(const std::string &filePath);
-    static void writeMdResults(const std::string &filePath);
+
+    // Output of a process running a test with --isolate, buffered like results of tests run here
+    static void appendIsolatedOutput(Configuration::PrintType printType, const std::string &output);
+    static void appendJsonRecords(const std::string &records);
+
+    // A report printed below the results, like API call tables. Only default output has reports.
+    static void appendReport(Configuration::PrintType printType, std::string report);
+    static void appendHtmlResults(const std::string &filePath);
+    static void finishHtmlResults(const std::string &filePath);
+    static void appendMdResults(const std::string &filePath);
+    static void finishMdResults(const std::string &filePath);
     static void setDeviceInfo(const std::string &info);
     void printStatisticsBeforeTest(const std::string &testCaseName) const;
     void printClearLineAfterTest() const;
     void printStatistics(const std::string &testCaseName) const;
     void printStatisticsString(const std::string &testCaseName, const std::string &message, char lineEnding = '\n') const;
+    void writeJsonResult(const std::string &testCaseName, const std::string &testCaseNameWithConfig, const TestCaseArgumentContainer &arguments, TestResult testResult) const;
+    void writeTimeline(const std::string &testCaseName) const;
 
   private:
     struct BufferedLine {
@@ -57,55 +115,116 @@ class TestCaseStatistics : public Statistics {
         bool isFullLine = false;
     };
 
+    struct RegisteredMetric {
+        Samples *samples; // map nodes are never moved, so the pointer stays valid
+        Value scale;      // converts seconds to the unit, or size per second to GB/s and GFLOPS
+        bool needsSize;
+    };
+
+    static int getWidestBufferedName();
+    static void writeBufferedLines(Configuration::PrintType printType);
+    static void writeResultFiles();
     static void overrideMeasurementUnit(MeasurementUnit &unit);
+    static size_t getIterationsToSkip(const Samples &samples);
     void pushValue(Value value, std::string_view description, MeasurementUnit unit, MeasurementType type);
+    Samples &getSamples(std::string_view description, MeasurementUnit unit, MeasurementType type);
+    void appendValue(Samples &samples, Value value);
+    bool shouldDropPreempted(const Samples &samples) const;
+    Samples &getIntervalSamples(std::string_view description, MeasurementUnit unit);
+    void appendTestValue(std::string_view description, MeasurementUnit unit, Value value);
+    static bool isPushedByBenchmark(const Samples &samples) { return !samples.perInterval && !samples.perTest; }
+    void startIntervalMeasurements();
+    void pushCpuUtilization();
+    void pushHostPower();
+    bool isMedianPreciseEnough(const Samples &samples) const;
     void printStatisticsDefault(const std::string &testCaseName) const;
     void printStatisticsNoop(const std::string &testCaseName) const;
     void printStatisticsCsv(const std::string &testCaseName) const;
     void printStatisticsVerbose() const;
+    std::vector<std::string> compareWithBaseline(const std::string &testCaseName, const std::string &samplesName, const Samples &samples, Value median) const;
     void collectHistograms(const std::string &testCaseName) const;
     std::string renderHistogram(const std::string &testCaseName, const std::string &samplesName, const Samples &samples) const;
 
     const Configuration::PrintType printType;
+    const bool streaming;
+    const bool recordTimeline;
+    const double targetRelativeError;
     SamplesMap samplesMap = {};
+    std::vector<RegisteredMetric> registeredMetrics = {};
+    size_t batchWarmupToDrop = 0;
+    mutable size_t nextPrecisionCheck = 0;
+    mutable bool reachedTargetPrecision = false;
     Samples noopSample = {};
     bool reachedInfinity = false;
 
+    // Iterations exist only for benchmarks calling endIteration. With --measureCpuTime each of them is
+    // one measured interval, otherwise a single interval covers the whole test. Host power always covers the whole test.
+    bool iterationsMarked = false;
+    const bool measureCpuTime;
+    CpuTimeTimer processCpuTimer{CpuTimeTimer::Scope::Process};
+    CpuTimeTimer testCpuTimer{CpuTimeTimer::Scope::Process};
+    Clock::time_point intervalStart = {};
+    Clock::time_point testStart = {};
+    std::unique_ptr<HostPowerMeter> hostPowerMeter = {};
+
+    // With --monitorOsNoise, whether the OS preempted any measurement of the current iteration
+    const bool monitorOsNoise;
+    const bool dropPreemptedSamples;
+    bool iterationPreempted = false;
+    size_t preemptedIterations = 0;
+    size_t droppedValues = 0;
+
+    // Results, histograms, API call tables and OS noise reports waiting for the name column width to be known. Bounded, see flushCompletedResults.
+    // Result files do not need the width, lines before linesWrittenToFiles are already written to them.
+    static constexpr size_t maxBufferedLines = 1000;
+    static constexpr size_t maxBufferedReports = 100;
     static std::vector<BufferedLine> testResults;
-    static std::vector<std::string> histograms;
+    static std::vector<std::string> reports;
+    static int nameColumnWidth;
+    static size_t linesWrittenToFiles;
+    static bool headerPrinted;
     static int lastTransientLineWidth;
     static std::string deviceInfo;
+    static bool jsonOutputCreated;
+    static bool timelineOutputCreated;
+    static bool htmlOutputCreated;
+    static bool mdOutputCreated;
 
     struct Metrics;
     struct MetricsStrings;
 };
 
 struct TestCaseStatistics::Metrics {
-    explicit Metrics(const SamplesVector &samples, size_t iterationsToSkip, size_t trimPercentage);
+    explicit Metrics(const SamplesVector &samples, size_t iterationsToSkip, size_t trimPercentage, const std::vector<double> &percentilesToCalculate);
+    explicit Metrics(const StreamingHistogram &histogram, size_t trimPercentage, const std::vector<double> &percentilesToCalculate);
     Value min;
     Value max;
     Value mean;
     Value median;
     Value standardDeviation;
+    std::vector<Value> percentiles;
 
   private:
     using ConstIter = SamplesVector::const_iterator;
+    void setNoSamples(size_t percentilesCount);
     static SamplesVector getTrimmedSamples(const SamplesVector &samples, size_t iterationsToSkip, size_t trimPercentage);
     static Value calculateMin(ConstIter begin, ConstIter end);
     static Value calculateMax(ConstIter begin, ConstIter end);
     static Value calculateMean(ConstIter begin, ConstIter end);
-    static Value calculateMedian(ConstIter begin, ConstIter end);
+    static Value calculateMedian(const SamplesVector &sorted);
+    static Value calculatePercentile(const SamplesVector &sorted, double percentile);
     static Value calculateStandardDeviation(ConstIter begin, ConstIter end, Value mean);
 };
 
 struct TestCaseStatistics::MetricsStrings {
-    MetricsStrings(const std::string &name, const Samples &samples, bool reachedInfinity, size_t iterationsToSkip, size_t trimPercentage);
+    MetricsStrings(const std::string &name, const Samples &samples, bool reachedInfinity, size_t iterationsToSkip, size_t trimPercentage, const std::vector<double> &percentilesToCalculate);
     Metrics metrics;
     std::string min;
     std::string max;
     std::string mean;
     std::string median;
     std::string standardDeviation;
+    std::vector<std::string> percentiles;
     std::string type;
     std::string label;
 
@@ -115,6 +234,7 @@ struct TestCaseStatistics::MetricsStrings {
     static std::string generateMean(Value mean, bool reachedInfinity);
     static std::string generateMedian(Value median);
     static std::string generateStandardDeviation(Value standardDeviation, bool reachedInfinity);
+    static std::vector<std::string> generatePercentiles(const std::vector<Value> &percentiles);
     static std::string generate(Value value);
     static std::string generateLabel(const std::string &name, MeasurementUnit unit);
 };
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "test_isolation.h"
+
+#include "framework/argument/abstract/argument.h"
+#include "framework/configuration.h"
+#include "framework/test_case/baseline_comparison.h"
+#include "framework/test_case/test_case_argument_container.h"
+#include "framework/test_case/test_case_statistics.h"
+#include "framework/utility/file_helper.h"
+#include "framework/utility/process.h"
+#include "framework/utility/working_directory_helper.h"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace {
+std::vector<std::pair<std::string, std::string>> forwardedArguments{};
+
+// Exit codes of BenchmarkMain::main
+constexpr int exitCodeSuccess = 0;
+constexpr int exitCodeRegression = 2;
+} // namespace
+
+void TestIsolation::setForwardedArguments(const CommandLineArguments &commandLineArguments) {
+    // The test and its API are given separately and file outputs are gathered by this process
+    const std::unordered_set<std::string> argumentsNotForwarded = {
+        "isolate", "timeout", "api", "jobs", "jobDeviceMasks", "shard", "shardMarkers",
+        "noHeaders", "noColumnNames", "noProgressBar", "htmlOutput", "mdOutput", "jsonOutput"};
+    forwardedArguments.clear();
+    for (const CommandLineArgument &argument : commandLineArguments) {
+        if (argument.getKey().find("gtest_") != 0 && argumentsNotForwarded.count(argument.getKey()) == 0) {
+            forwardedArguments.emplace_back(argument.getKey(), argument.getValue());
+        }
+    }
+}
+
+TestResult TestIsolation::runTest(const std::string &testCaseName, const TestCaseArgumentContainer &arguments, std::string &outErrorReason) {
+    const Configuration &configuration = Configuration::get();
+
+    Process process{WorkingDirectoryHelper::getExeLocation().string()};
+    process.setSynchronizationArguments(false);
+    for (const auto &[key, value] : forwardedArguments) {
+        process.addArgument(key, value);
+    }
+    process.addArgument("test", testCaseName);
+    process.addArgument("api", std::to_string(arguments.api));
+    for (const Argument *argument : arguments.getArguments()) {
+        process.addArgument(argument->getKey(), argument->getValueString());
+    }
+
+    // A record left by a process killed before writing its own must not be taken for it
+    const std::string &jsonPath = configuration.jsonOutput;
+    const std::string processJsonPath = jsonPath.empty() ? "" : jsonPath + ".isolated";
+    if (!processJsonPath.empty()) {
+        std::remove(processJsonPath.c_str());
+        process.addArgument("jsonOutput", processJsonPath);
+    }
+    process.addArgument("isolatedTest", "");
+    process.addArgument("noHeaders", "");
+    process.addArgument("noColumnNames", "");
+    process.addArgument("noProgressBar", "");
+    process.setName(testCaseName);
+
+    process.run();
+    process.waitForFinishOrKill(std::chrono::seconds(static_cast<size_t>(configuration.timeout)));
+    const int exitCode = static_cast<int>(process.getResult());
+    if (const std::string &reason = process.getTerminationReason(); !reason.empty()) {
+        outErrorReason = reason;
+        return TestResult::Error;
+    }
+    if (exitCode != exitCodeSuccess && exitCode != exitCodeRegression) {
+        outErrorReason = "exited with code " + std::to_string(exitCode);
+        return TestResult::Error;
+    }
+
+    if (exitCode == exitCodeRegression) {
+        BaselineComparison::markRegressionFound();
+    }
+    TestCaseStatistics::appendIsolatedOutput(configuration.printType, process.getStdout());
+    if (!processJsonPath.empty() && std::filesystem::exists(processJsonPath)) {
+        const std::vector<uint8_t> records = FileHelper::loadTextFile(processJsonPath);
+        TestCaseStatistics::appendJsonRecords(std::string{records.begin(), records.end()});
+        std::remove(processJsonPath.c_str());
+    }
+    return TestResult::Success;
+}
@@ -0,0 +1,27 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/test_case/test_result.h"
+#include "framework/utility/command_line_argument.h"
+
+#include <string>
+
+struct TestCaseArgumentContainer;
+
+// Runs tests of all-tests mode in separate processes, with --isolate. Each process is this benchmark
+// in single-test mode, started with the arguments of this process and of the test, and its results
+// are merged into the output of this one. A process which crashes or runs longer than --timeout is
+// killed, so a broken test is reported as an error instead of ending or stalling the whole run.
+struct TestIsolation {
+    // Arguments passed on to the processes, except for the ones describing this process
+    static void setForwardedArguments(const CommandLineArguments &commandLineArguments);
+
+    // Returns TestResult::Error with the reason if the process did not finish by itself
+    static TestResult runTest(const std::string &testCaseName, const TestCaseArgumentContainer &arguments, std::string &outErrorReason);
+};
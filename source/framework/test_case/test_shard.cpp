@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "test_shard.h"
+
+#include "framework/configuration.h"
+#include "framework/test_case/test_case_statistics.h"
+
+#include <iostream>
+
+namespace {
+size_t nextTestIndex = 0;
+size_t nextParallelTestIndex = 0; // tests which can run in parallel are dealt separately, so shards stay balanced
+} // namespace
+
+bool TestShard::claimNextTest(bool mustRunAlone) {
+    const ShardArgument::Shard &shard = Configuration::get().shard;
+    const size_t testIndex = nextTestIndex++;
+
+    bool claimed = false;
+    if (mustRunAlone) {
+        claimed = shard.alone;
+    } else {
+        const size_t parallelTestIndex = nextParallelTestIndex++;
+        claimed = !shard.alone && parallelTestIndex % shard.count == shard.index;
+    }
+
+    if (claimed && Configuration::get().shardMarkers) {
+        // Results of the previous test must not end up after the marker
+        TestCaseStatistics::flushCompletedResults(Configuration::get().printType);
+        std::cout << testMarker << testIndex << '\n';
+    }
+    return claimed;
+}
+
+void TestShard::printEndMarker() {
+    if (Configuration::get().shardMarkers) {
+        std::cout << endMarker << std::endl;
+    }
+}
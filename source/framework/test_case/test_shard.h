@@ -0,0 +1,28 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+
+// Splits the tests selected by the filters between processes, with --shard. Tests are numbered in the
+// order they are run, which is the same in every process started with the same arguments, and are
+// dealt round-robin, so the neighbouring configurations of a test, usually similar in cost, end up
+// in different shards. Tests which must run alone are all left to --shard=alone.
+//
+// With --shardMarkers each test run by the shard is preceded by a marker line with its number, so
+// BenchmarkMain can merge outputs of all shards back into the order of a serial run. Names in result
+// lines are then followed by nameSeparator instead of padding, so the merged columns can be aligned.
+struct TestShard {
+    static constexpr const char *testMarker = "##shard-test ";
+    static constexpr const char *endMarker = "##shard-end";
+    static constexpr char nameSeparator = '\x1f';
+
+    // Numbers the next selected test and tells whether it is run by this process
+    static bool claimNextTest(bool mustRunAlone);
+    static void printEndMarker();
+};
@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "api_call_statistics.h"
+
+#include "framework/configuration.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+bool ApiCallStatistics::enabled = false;
+
+namespace {
+std::mutex callSitesMutex;
+std::vector<ApiCallStatistics::CallSite *> callSites;
+
+// "zeCommandListAppendLaunchKernel(cmdList, kernel, ...)" -> "zeCommandListAppendLaunchKernel"
+std::string getFunctionName(const char *expression) {
+    std::string name(expression, std::find(expression, expression + std::char_traits<char>::length(expression), '('));
+    name.erase(std::remove_if(name.begin(), name.end(), [](char c) { return std::isspace(static_cast<unsigned char>(c)); }), name.end());
+    return name;
+}
+
+std::string toMicroseconds(double nanoseconds) {
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(3) << nanoseconds / 1000;
+    return stream.str();
+}
+} // namespace
+
+ApiCallStatistics::CallSite::CallSite(const char *expression) : expression(expression) {
+    std::lock_guard lock(callSitesMutex);
+    callSites.push_back(this);
+}
+
+void ApiCallStatistics::CallSite::record(uint64_t nanoseconds) {
+    count.fetch_add(1, std::memory_order_relaxed);
+    totalNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+    buckets[getBucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+    uint64_t max = maxNanoseconds.load(std::memory_order_relaxed);
+    while (nanoseconds > max && !maxNanoseconds.compare_exchange_weak(max, nanoseconds, std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t ApiCallStatistics::now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void ApiCallStatistics::startTest() {
+    enabled = Configuration::get().apiCallStatistics > 0;
+
+    std::lock_guard lock(callSitesMutex);
+    for (CallSite *callSite : callSites) {
+        callSite->count = 0;
+        callSite->totalNanoseconds = 0;
+        callSite->maxNanoseconds = 0;
+        for (auto &bucket : callSite->buckets) {
+            bucket = 0;
+        }
+    }
+}
+
+std::string ApiCallStatistics::renderReport(const std::string &testCaseName, size_t topCount) {
+    struct Function {
+        uint64_t count = 0;
+        uint64_t totalNanoseconds = 0;
+        uint64_t maxNanoseconds = 0;
+        std::vector<uint64_t> buckets = std::vector<uint64_t>(bucketCount, 0);
+    };
+    std::map<std::string, Function> functions;
+    {
+        std::lock_guard lock(callSitesMutex);
+        for (const CallSite *callSite : callSites) {
+            if (callSite->count == 0) {
+                continue;
+            }
+            Function &function = functions[getFunctionName(callSite->expression)];
+            function.count += callSite->count;
+            function.totalNanoseconds += callSite->totalNanoseconds;
+            function.maxNanoseconds = std::max<uint64_t>(function.maxNanoseconds, callSite->maxNanoseconds);
+            for (size_t i = 0; i < bucketCount; i++) {
+                function.buckets[i] += callSite->buckets[i];
+            }
+        }
+    }
+    if (functions.empty()) {
+        return {};
+    }
+
+    std::vector<std::pair<std::string, const Function *>> sorted;
+    for (const auto &function : functions) {
+        sorted.emplace_back(function.first, &function.second);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const auto &a, const auto &b) { return a.second->totalNanoseconds > b.second->totalNanoseconds; });
+    sorted.resize(std::min(sorted.size(), topCount));
+
+    auto getPercentile = [](const Function &function, double percentile) -> uint64_t {
+        const uint64_t rank = static_cast<uint64_t>(std::ceil(percentile * static_cast<double>(function.count)));
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < bucketCount; i++) {
+            cumulative += function.buckets[i];
+            if (cumulative >= std::max<uint64_t>(rank, 1)) {
+                return std::min(getBucketMiddle(i), function.maxNanoseconds);
+            }
+        }
+        return function.maxNanoseconds;
+    };
+
+    size_t nameWidth = std::string("Function").size();
+    for (const auto &function : sorted) {
+        nameWidth = std::max(nameWidth, function.first.size());
+    }
+
+    std::ostringstream out;
+    out << "API calls: " << testCaseName << " (timing them perturbs the results above)\n";
+    out << "  " << std::left << std::setw(static_cast<int>(nameWidth)) << "Function" << std::right
+        << std::setw(12) << "Calls" << std::setw(15) << "Total [us]" << std::setw(15) << "Mean [us]"
+        << std::setw(15) << "Median [us]" << std::setw(15) << "P99 [us]" << std::setw(15) << "Max [us]" << "\n";
+    for (const auto &[name, function] : sorted) {
+        out << "  " << std::left << std::setw(static_cast<int>(nameWidth)) << name << std::right
+            << std::setw(12) << function->count
+            << std::setw(15) << toMicroseconds(static_cast<double>(function->totalNanoseconds))
+            << std::setw(15) << toMicroseconds(static_cast<double>(function->totalNanoseconds) / static_cast<double>(function->count))
+            << std::setw(15) << toMicroseconds(static_cast<double>(getPercentile(*function, 0.5)))
+            << std::setw(15) << toMicroseconds(static_cast<double>(getPercentile(*function, 0.99)))
+            << std::setw(15) << toMicroseconds(static_cast<double>(function->maxNanoseconds)) << "\n";
+    }
+    if (functions.size() > sorted.size()) {
+        out << "  (" << functions.size() - sorted.size() << " more functions called)\n";
+    }
+    return out.str();
+}
+
+size_t ApiCallStatistics::getBucketIndex(uint64_t nanoseconds) {
+    if (nanoseconds < linearBuckets) {
+        return static_cast<size_t>(nanoseconds);
+    }
+    size_t exponent = 0;
+    for (uint64_t value = nanoseconds; value > 1; value >>= 1) {
+        exponent++;
+    }
+    const size_t subBucket = static_cast<size_t>(nanoseconds >> (exponent - subBucketBits)) & ((1 << subBucketBits) - 1);
+    return linearBuckets + (exponent - 4) * (1 << subBucketBits) + subBucket;
+}
+
+uint64_t ApiCallStatistics::getBucketMiddle(size_t index) {
+    if (index < linearBuckets) {
+        return index;
+    }
+    const size_t exponent = (index - linearBuckets) / (1 << subBucketBits) + 4;
+    const uint64_t subBucket = (index - linearBuckets) % (1 << subBucketBits);
+    const uint64_t width = uint64_t{1} << (exponent - subBucketBits);
+    return ((1 << subBucketBits) + subBucket) * width + width / 2;
+}
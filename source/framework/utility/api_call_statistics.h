@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Counts calls and their latencies, with --apiCallStatistics=N, for every API call checked by the
+// result macros, e.g. ASSERT_ZE_RESULT_SUCCESS. These wrap almost every call the benchmarks make, so
+// no benchmark has to change and it works the same against a real driver and a NULL_L0 build. The
+// latter shows the overhead of the benchmark's own code around each call.
+//
+// Each call site has its own counters, updated with relaxed atomics, so calls from several threads
+// do not serialize. After each test the call sites are grouped by the called function and the
+// N functions with the highest total time are printed after the results.
+//
+// Only expressions calling a function are timed, results already stored in a variable are not.
+// Timing a call reads the clock twice, often inside a region measured by the benchmark, so results
+// of a run with --apiCallStatistics are perturbed and should not be compared with other runs.
+class ApiCallStatistics {
+  public:
+    // Latencies are kept in log-linear buckets, 8 per power of two, so percentiles are within 12.5%
+    static constexpr size_t linearBuckets = 16;
+    static constexpr size_t subBucketBits = 3;
+    static constexpr size_t bucketCount = linearBuckets + (64 - 4) * (1 << subBucketBits);
+
+    struct CallSite {
+        explicit CallSite(const char *expression);
+        void record(uint64_t nanoseconds);
+
+        const char *expression;
+        std::atomic<uint64_t> count = 0;
+        std::atomic<uint64_t> totalNanoseconds = 0;
+        std::atomic<uint64_t> maxNanoseconds = 0;
+        std::array<std::atomic<uint64_t>, bucketCount> buckets = {};
+    };
+
+    static bool isEnabled() { return enabled; }
+    static constexpr bool isCall(std::string_view expression) { return expression.find('(') != std::string_view::npos; }
+    static uint64_t now();
+
+    static void startTest();
+    static std::string renderReport(const std::string &testCaseName, size_t topCount);
+
+    static size_t getBucketIndex(uint64_t nanoseconds);
+    static uint64_t getBucketMiddle(size_t index);
+
+  private:
+    static bool enabled;
+};
+
+#define API_CALL_STATISTICS_BEGIN(expression) \
+    const uint64_t apiCallStartForDefine = ApiCallStatistics::isCall(expression) && ApiCallStatistics::isEnabled() ? ApiCallStatistics::now() : 0;
+
+#define API_CALL_STATISTICS_END(expression)                                            \
+    if (apiCallStartForDefine != 0) {                                                  \
+        static ApiCallStatistics::CallSite apiCallSiteForDefine{expression};           \
+        apiCallSiteForDefine.record(ApiCallStatistics::now() - apiCallStartForDefine); \
+    }
@@ -13,18 +13,32 @@
 #include <framework/utility/cpu_counter.h>
 #include <framework/utility/statistics.h>
 #include <framework/utility/timer.h>
+#include <iostream>
+#include <string_view>
 #include <unordered_set>
+#include <vector>
 
 class ComboProfiler {
   public:
     ComboProfiler(ProfilerType profiler = ProfilerType::Timer)
         : profiler_type(profiler) {
+        if (!areCpuCountersAvailable()) {
+            static bool warningPrinted = false;
+            if (!warningPrinted) {
+                std::cerr << "WARNING: CPU counters are unavailable, falling back to --profilerType=timer\n";
+                warningPrinted = true;
+            }
+            profiler_type = ProfilerType::Timer;
+        }
+
         switch (profiler_type) {
         case ProfilerType::Timer:
+        case ProfilerType::Tsc:
             measurement.setUnit(MeasurementUnit::Microseconds);
             measurement.setType(MeasurementType::Cpu);
             break;
         case ProfilerType::CpuCounter:
+        case ProfilerType::CpuCounterGroup:
             measurement.setUnit(MeasurementUnit::CpuHardwareCounter);
             measurement.setType(MeasurementType::Cpu);
             break;
@@ -38,7 +52,11 @@ class ComboProfiler {
         case ProfilerType::CpuCounter:
             cpuCounter.measureStart();
             break;
+        case ProfilerType::CpuCounterGroup:
+            cpuCounterGroup.measureStart();
+            break;
         case ProfilerType::Timer:
+        case ProfilerType::Tsc:
             timer.measureStart();
             break;
         default:
@@ -49,20 +67,36 @@ class ComboProfiler {
     inline void measureEnd() {
         switch (profiler_type) {
         case ProfilerType::Timer:
+        case ProfilerType::Tsc:
             timer.measureEnd();
             break;
         case ProfilerType::CpuCounter:
             cpuCounter.measureEnd();
             break;
+        case ProfilerType::CpuCounterGroup:
+            cpuCounterGroup.measureEnd();
+            break;
         default:
             FATAL_ERROR("Undefined ProfilerType provided");
         }
     }
 
   protected:
+    bool areCpuCountersAvailable() const {
+        switch (profiler_type) {
+        case ProfilerType::CpuCounter:
+            return CpuCounter::isAvailable();
+        case ProfilerType::CpuCounterGroup:
+            return CpuCounterGroup::isAvailable();
+        default:
+            return true;
+        }
+    }
+
     ProfilerType profiler_type;
     Timer timer;
     CpuCounter cpuCounter;
+    CpuCounterGroup cpuCounterGroup;
     MeasurementFields measurement;
 };
 
@@ -74,6 +108,7 @@ class ComboProfilerWithStats : public ComboProfiler {
     void pushStats(Statistics &statistics) {
         switch (profiler_type) {
         case ProfilerType::Timer:
+        case ProfilerType::Tsc:
             if (timer.measurementIsReady()) {
                 statistics.pushValue(
                     timer.get(),
@@ -91,6 +126,11 @@ class ComboProfilerWithStats : public ComboProfiler {
                     "hw instructions");
             }
             break;
+        case ProfilerType::CpuCounterGroup:
+            if (cpuCounterGroup.measurementIsReady()) {
+                pushCpuCounterGroupStats(statistics, cpuCounterGroup.getEvents(), cpuCounterGroup.get());
+            }
+            break;
         default:
             FATAL_ERROR("Undefined ProfilerType provided");
         }
@@ -101,4 +141,82 @@ class ComboProfilerWithStats : public ComboProfiler {
         statistics.pushUnitAndType(
             measurement.getUnit(), measurement.getType());
     }
+
+    // Pushes one sample combining measurements of several threads, each of them made by its own
+    // profiler. Times are averaged, while counters are summed, so they show the total CPU work.
+    static void pushAggregatedStats(Statistics &statistics, const std::vector<const ComboProfilerWithStats *> &profilers, std::string_view timeDescription) {
+        if (profilers.empty()) {
+            return;
+        }
+        const ComboProfilerWithStats &first = *profilers[0];
+        switch (first.profiler_type) {
+        case ProfilerType::Timer:
+        case ProfilerType::Tsc: {
+            auto totalTime = std::chrono::high_resolution_clock::duration(0);
+            for (const ComboProfilerWithStats *profiler : profilers) {
+                totalTime += profiler->timer.get();
+            }
+            statistics.pushValue(
+                totalTime / profilers.size(),
+                first.measurement.getUnit(),
+                first.measurement.getType(),
+                timeDescription);
+            break;
+        }
+        case ProfilerType::CpuCounter: {
+            uint64_t totalCount = 0;
+            for (const ComboProfilerWithStats *profiler : profilers) {
+                totalCount += profiler->cpuCounter.get();
+            }
+            statistics.pushCpuCounter(
+                totalCount,
+                first.measurement.getUnit(),
+                first.measurement.getType(),
+                "hw instructions");
+            break;
+        }
+        case ProfilerType::CpuCounterGroup: {
+            // Every thread opens the same events, so counts can be summed position by position
+            std::vector<uint64_t> totalCounts(first.cpuCounterGroup.get().size(), 0);
+            for (const ComboProfilerWithStats *profiler : profilers) {
+                const std::vector<uint64_t> &counts = profiler->cpuCounterGroup.get();
+                for (size_t i = 0; i < totalCounts.size() && i < counts.size(); i++) {
+                    totalCounts[i] += counts[i];
+                }
+            }
+            first.pushCpuCounterGroupStats(statistics, first.cpuCounterGroup.getEvents(), totalCounts);
+            break;
+        }
+        default:
+            FATAL_ERROR("Undefined ProfilerType provided");
+        }
+    }
+
+  private:
+    void pushCpuCounterGroupStats(Statistics &statistics, const std::vector<CpuCounterEvent> &events, const std::vector<uint64_t> &counts) const {
+        uint64_t cycles = 0;
+        uint64_t instructions = 0;
+        for (size_t i = 0; i < events.size() && i < counts.size(); i++) {
+            statistics.pushCpuCounter(
+                counts[i],
+                measurement.getUnit(),
+                measurement.getType(),
+                getCpuCounterEventInfo(events[i]).label);
+            if (events[i] == CpuCounterEvent::Cycles) {
+                cycles = counts[i];
+            } else if (events[i] == CpuCounterEvent::Instructions) {
+                instructions = counts[i];
+            }
+        }
+
+        const bool countsCycles = std::find(events.begin(), events.end(), CpuCounterEvent::Cycles) != events.end();
+        const bool countsInstructions = std::find(events.begin(), events.end(), CpuCounterEvent::Instructions) != events.end();
+        if (countsCycles && countsInstructions) {
+            statistics.pushRatio(
+                cycles != 0 ? static_cast<double>(instructions) / static_cast<double>(cycles) : 0.0,
+                MeasurementUnit::Ratio,
+                measurement.getType(),
+                "IPC");
+        }
+    }
 };
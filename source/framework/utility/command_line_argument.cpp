@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -60,6 +60,12 @@ void CommandLineArgument::markAsProcessed() {
     this->processed = true;
 }
 
+CommandLineArgument CommandLineArgument::withValue(const std::string &newValue) const {
+    CommandLineArgument result{*this};
+    result.value = newValue;
+    return result;
+}
+
 bool CommandLineArgument::isKeyEqualTo(const std::string &otherKey) const {
     if (!valid) {
         return false;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,7 +15,6 @@ class CommandLineArgument {
     using CommandLineArguments = std::vector<CommandLineArgument>;
 
     CommandLineArgument(const char *token);
-    CommandLineArgument(const CommandLineArgument &) = delete;
     CommandLineArgument &operator=(const CommandLineArgument &) = delete;
     CommandLineArgument(CommandLineArgument &&) = default;
     CommandLineArgument &operator=(CommandLineArgument &&) = default;
@@ -25,6 +24,9 @@ class CommandLineArgument {
 
     void markAsProcessed();
 
+    // Copies are made only explicitly, e.g. for each point of a sweep
+    CommandLineArgument withValue(const std::string &newValue) const;
+
     const std::string &getKey() const { return key; }
     const std::string &getValue() const { return value; }
     bool isKeyEqualTo(const std::string &key) const;
@@ -32,6 +34,8 @@ class CommandLineArgument {
     bool isProcessed() const { return processed; }
 
   private:
+    CommandLineArgument(const CommandLineArgument &) = default;
+
     std::string key = "";
     std::string value = "";
     bool valid = true;
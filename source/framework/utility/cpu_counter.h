@@ -6,18 +6,98 @@
  */
 
 #pragma once
+#include <atomic>
 #include <cerrno>
 #include <chrono>
 #include <cstdio>
 #include <framework/configuration.h>
+#include <framework/utility/trace_recorder.h>
+#include <iterator>
+#include <string>
+#include <vector>
 #if defined(__ARM_ARCH)
 #include <sse2neon.h>
 #else
 #include <emmintrin.h>
 #endif
 
+// Events which can be counted together with --profilerType=cpucountergroup. Names are used in
+// --cpuCounterEvents, labels describe the metrics pushed for them.
+enum class CpuCounterEvent {
+    Cycles,
+    Instructions,
+    LlcMisses,
+    BranchMisses,
+    DtlbMisses,
+    PageFaults,
+    ContextSwitches,
+    COUNT,
+};
+
+struct CpuCounterEventInfo {
+    const char *name;
+    const char *label;
+};
+
+inline constexpr CpuCounterEventInfo cpuCounterEventInfos[] = {
+    {"cycles", "cycles"},
+    {"instructions", "instructions"},
+    {"llc-misses", "LLC misses"},
+    {"branch-misses", "branch misses"},
+    {"dtlb-misses", "dTLB misses"},
+    {"page-faults", "page faults"},
+    {"context-switches", "context switches"},
+};
+static_assert(std::size(cpuCounterEventInfos) == static_cast<size_t>(CpuCounterEvent::COUNT));
+
+inline const CpuCounterEventInfo &getCpuCounterEventInfo(CpuCounterEvent event) {
+    return cpuCounterEventInfos[static_cast<size_t>(event)];
+}
+
+inline bool parseCpuCounterEvent(const std::string &name, CpuCounterEvent &outEvent) {
+    for (size_t i = 0; i < std::size(cpuCounterEventInfos); i++) {
+        if (name == cpuCounterEventInfos[i].name) {
+            outEvent = static_cast<CpuCounterEvent>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Selected events, or all of them if --cpuCounterEvents was not passed
+inline std::vector<CpuCounterEvent> getSelectedCpuCounterEvents() {
+    std::vector<CpuCounterEvent> events{};
+    const std::vector<std::string> &names = Configuration::get().cpuCounterEvents;
+    if (names.empty()) {
+        for (size_t i = 0; i < static_cast<size_t>(CpuCounterEvent::COUNT); i++) {
+            events.push_back(static_cast<CpuCounterEvent>(i));
+        }
+    }
+    for (const std::string &name : names) {
+        CpuCounterEvent event{};
+        FATAL_ERROR_IF(!parseCpuCounterEvent(name, event), "Unknown CPU counter event: ", name);
+        events.push_back(event);
+    }
+    return events;
+}
+
+// Counters are opened by each thread on its first measurement. Failing to open them is reported
+// once per process, since every thread would fail the same way.
+inline void printCpuCounterUnavailableWarning(const char *eventName, const char *reason) {
+    static std::atomic<bool> printed{false};
+    if (!printed.exchange(true)) {
+        fprintf(stderr, "WARNING: cannot open CPU counter %s: %s\n", eventName, reason);
+    }
+}
+
 #if defined(_WIN32)
 struct PerfLib {
+    PerfLib() {
+        printCpuCounterUnavailableWarning("instructions", "not supported on Windows");
+    }
+    bool isAvailable() const {
+        return false;
+    }
     void start() {
     }
     uint64_t end() {
@@ -26,9 +106,29 @@ struct PerfLib {
 };
 
 inline PerfLib &Perf() {
-    static PerfLib perf;
+    thread_local PerfLib perf;
     return perf;
 }
+
+struct PerfEventGroup {
+    PerfEventGroup() {
+        printCpuCounterUnavailableWarning("group", "not supported on Windows");
+    }
+    bool isAvailable() const {
+        return false;
+    }
+    void start() {
+    }
+    void end(std::vector<uint64_t> &counts) {
+        counts.assign(events.size(), 0);
+    }
+    std::vector<CpuCounterEvent> events;
+};
+
+inline PerfEventGroup &PerfGroup() {
+    thread_local PerfEventGroup perfGroup;
+    return perfGroup;
+}
 #else
 #include <assert.h>
 #include <dlfcn.h>
@@ -55,6 +155,8 @@ inline bool excludeKernelEvents = []() {
     return 1;
 }();
 
+// Counts of the calling thread. With --cpuCounterInherit, threads it creates afterwards are counted
+// as well and their counts are added to it when they exit.
 struct PerfLib {
     PerfLib() {
         struct perf_event_attr performanceEvent;
@@ -66,18 +168,32 @@ struct PerfLib {
         performanceEvent.exclude_kernel = excludeKernelEvents;
         // Don't count hypervisor events.
         performanceEvent.exclude_hv = 1;
-        fd = perf_event_open(&performanceEvent, 0, -1, -1, 0);
+        performanceEvent.inherit = Configuration::get().cpuCounterInherit;
+        fd = static_cast<int>(perf_event_open(&performanceEvent, 0, -1, -1, 0));
         if (fd == -1) {
-            fprintf(stderr, "Error opening leader %llx: %s\n", performanceEvent.config, strerror(errno));
-            exit(EXIT_FAILURE);
+            printCpuCounterUnavailableWarning("instructions", strerror(errno));
+        }
+    }
+    ~PerfLib() {
+        if (fd != -1) {
+            close(fd);
         }
     }
+    bool isAvailable() const {
+        return fd != -1;
+    }
     void start() {
+        if (fd == -1) {
+            return;
+        }
         ioctl(fd, PERF_EVENT_IOC_RESET, 0);
         ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
     }
     uint64_t end() {
         uint64_t count = 0;
+        if (fd == -1) {
+            return count;
+        }
         ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
         auto ret = read(fd, &count, sizeof(uint64_t));
         if (ret < 0) {
@@ -86,13 +202,149 @@ struct PerfLib {
         }
         return count;
     }
-    int fd;
+    int fd = -1;
 };
 
 inline PerfLib &Perf() {
-    static PerfLib perf;
+    thread_local PerfLib perf;
     return perf;
 }
+
+// Counts several events of the calling thread as one perf group. The group is enabled, disabled and
+// read through its leader, so all counters cover exactly the same instructions and are read with a
+// single syscall. When the kernel multiplexes the group with other events, counts are scaled up by
+// the fraction of time the group was actually counting. The kernel does not allow reading inherited
+// counters as a group, so with --cpuCounterInherit each of them is read separately.
+struct PerfEventGroup {
+    PerfEventGroup() {
+        const bool inherit = Configuration::get().cpuCounterInherit;
+        for (const CpuCounterEvent event : getSelectedCpuCounterEvents()) {
+            struct perf_event_attr performanceEvent = getAttributes(event);
+            const bool isLeader = fds.empty();
+            performanceEvent.disabled = isLeader;
+            performanceEvent.inherit = inherit;
+            performanceEvent.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING | (inherit ? 0 : PERF_FORMAT_GROUP);
+            const int fd = static_cast<int>(perf_event_open(&performanceEvent, 0, -1, isLeader ? -1 : fds[0], 0));
+            if (fd == -1 && isLeader) {
+                printCpuCounterUnavailableWarning(getCpuCounterEventInfo(event).name, strerror(errno));
+                return;
+            }
+            if (fd == -1) {
+                // e.g. dTLB events are not exposed by every CPU or hypervisor
+                fprintf(stderr, "WARNING: CPU counter event %s is not available: %s\n", getCpuCounterEventInfo(event).name, strerror(errno));
+                continue;
+            }
+            fds.push_back(fd);
+            events.push_back(event);
+        }
+        readBuffer.resize(3 + fds.size());
+        readGroup = !inherit;
+    }
+    ~PerfEventGroup() {
+        for (const int fd : fds) {
+            close(fd);
+        }
+    }
+    bool isAvailable() const {
+        return !fds.empty();
+    }
+    void start() {
+        if (fds.empty()) {
+            return;
+        }
+        ioctl(fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+    void end(std::vector<uint64_t> &counts) {
+        counts.assign(fds.size(), 0);
+        if (fds.empty()) {
+            return;
+        }
+        ioctl(fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+        if (readGroup) {
+            // Layout of PERF_FORMAT_GROUP: nr, time_enabled, time_running, value[nr]
+            auto ret = read(fds[0], readBuffer.data(), readBuffer.size() * sizeof(uint64_t));
+            if (ret < 0 || readBuffer[0] != fds.size()) {
+                fprintf(stderr, "Error reading counter group\n");
+                exit(EXIT_FAILURE);
+            }
+            for (size_t i = 0; i < fds.size(); i++) {
+                counts[i] = scale(readBuffer[3 + i], readBuffer[1], readBuffer[2]);
+            }
+            return;
+        }
+
+        for (size_t i = 0; i < fds.size(); i++) {
+            // Layout without PERF_FORMAT_GROUP: value, time_enabled, time_running
+            auto ret = read(fds[i], readBuffer.data(), 3 * sizeof(uint64_t));
+            if (ret < 0) {
+                fprintf(stderr, "Error reading counter\n");
+                exit(EXIT_FAILURE);
+            }
+            counts[i] = scale(readBuffer[0], readBuffer[1], readBuffer[2]);
+        }
+    }
+
+    static uint64_t scale(uint64_t count, uint64_t timeEnabled, uint64_t timeRunning) {
+        if (timeRunning != 0 && timeRunning < timeEnabled) {
+            return static_cast<uint64_t>(static_cast<double>(count) * timeEnabled / timeRunning);
+        }
+        return count;
+    }
+
+    static struct perf_event_attr getAttributes(CpuCounterEvent event) {
+        struct perf_event_attr performanceEvent;
+        memset(&performanceEvent, 0, sizeof(struct perf_event_attr));
+        performanceEvent.size = sizeof(struct perf_event_attr);
+        performanceEvent.type = PERF_TYPE_HARDWARE;
+        performanceEvent.exclude_kernel = excludeKernelEvents;
+        // Don't count hypervisor events.
+        performanceEvent.exclude_hv = 1;
+        switch (event) {
+        case CpuCounterEvent::Cycles:
+            performanceEvent.config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case CpuCounterEvent::Instructions:
+            performanceEvent.config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case CpuCounterEvent::LlcMisses:
+            performanceEvent.config = PERF_COUNT_HW_CACHE_MISSES;
+            break;
+        case CpuCounterEvent::BranchMisses:
+            performanceEvent.config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+        case CpuCounterEvent::DtlbMisses:
+            performanceEvent.type = PERF_TYPE_HW_CACHE;
+            performanceEvent.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            break;
+        case CpuCounterEvent::PageFaults:
+            // Software events are raised by the kernel on behalf of the thread, so they are never excluded
+            performanceEvent.type = PERF_TYPE_SOFTWARE;
+            performanceEvent.config = PERF_COUNT_SW_PAGE_FAULTS;
+            performanceEvent.exclude_kernel = 0;
+            break;
+        case CpuCounterEvent::ContextSwitches:
+            performanceEvent.type = PERF_TYPE_SOFTWARE;
+            performanceEvent.config = PERF_COUNT_SW_CONTEXT_SWITCHES;
+            performanceEvent.exclude_kernel = 0;
+            break;
+        default:
+            FATAL_ERROR("Unknown CPU counter event");
+        }
+        return performanceEvent;
+    }
+
+    std::vector<CpuCounterEvent> events;
+    std::vector<int> fds;
+    std::vector<uint64_t> readBuffer;
+    bool readGroup = true;
+};
+
+inline PerfEventGroup &PerfGroup() {
+    thread_local PerfEventGroup perfGroup;
+    return perfGroup;
+}
 #endif
 
 class CpuCounter {
@@ -101,6 +353,7 @@ class CpuCounter {
         if (Configuration::get().markTimers) {
             markTimers = true;
         }
+        traceSpans = TraceRecorder::isEnabled();
     }
 
     void measureStart() {
@@ -111,6 +364,9 @@ class CpuCounter {
             FATAL_ERROR("CpuCounter measureStart called twice without measureEnd in the middle\n");
         }
         state = State::STARTED;
+        if (traceSpans) {
+            traceBeginNs = TraceRecorder::now();
+        }
         // make sure that any pending instructions are done and all memory transactions committed.
         _mm_mfence();
         _mm_lfence();
@@ -129,6 +385,9 @@ class CpuCounter {
         } else {
             FATAL_ERROR("CpuCounter measureEnd called without measureStart\n");
         }
+        if (traceSpans) {
+            TraceRecorder::recordSpan("CpuCounter", traceBeginNs, TraceRecorder::now(), traceIteration++);
+        }
 
         if (this->markTimers) {
             printf("\n CPU counter END \n");
@@ -139,10 +398,18 @@ class CpuCounter {
         return events;
     }
 
+    // Counters cannot be opened e.g. with perf_event_paranoid > 2 or inside VMs without PMU
+    static bool isAvailable() {
+        return Perf().isAvailable();
+    }
+
     bool measurementIsReady() const { return state == State::READY; }
 
   private:
     bool markTimers = false;
+    bool traceSpans = false;
+    uint64_t traceBeginNs = 0;
+    size_t traceIteration = 0;
     uint64_t events = 0;
 
     enum class State { IDLE,
@@ -150,3 +417,78 @@ class CpuCounter {
                        READY };
     State state = State::IDLE;
 };
+
+class CpuCounterGroup {
+  public:
+    CpuCounterGroup() {
+        if (Configuration::get().markTimers) {
+            markTimers = true;
+        }
+        traceSpans = TraceRecorder::isEnabled();
+    }
+
+    void measureStart() {
+        if (this->markTimers) {
+            printf("\n CPU counter group START \n");
+        }
+        if (state == State::STARTED) {
+            FATAL_ERROR("CpuCounterGroup measureStart called twice without measureEnd in the middle\n");
+        }
+        state = State::STARTED;
+        if (traceSpans) {
+            traceBeginNs = TraceRecorder::now();
+        }
+        // make sure that any pending instructions are done and all memory transactions committed.
+        _mm_mfence();
+        _mm_lfence();
+
+        PerfGroup().start();
+    }
+
+    void measureEnd() {
+        // make sure that any pending instructions are done and all memory transactions committed.
+        _mm_mfence();
+        _mm_lfence();
+
+        PerfGroup().end(counts);
+        if (state == State::STARTED) {
+            state = State::READY;
+        } else {
+            FATAL_ERROR("CpuCounterGroup measureEnd called without measureStart\n");
+        }
+        if (traceSpans) {
+            TraceRecorder::recordSpan("CpuCounterGroup", traceBeginNs, TraceRecorder::now(), traceIteration++);
+        }
+
+        if (this->markTimers) {
+            printf("\n CPU counter group END \n");
+        }
+    }
+
+    // Counts of getEvents(), in the same order
+    const std::vector<uint64_t> &get() const {
+        return counts;
+    }
+
+    const std::vector<CpuCounterEvent> &getEvents() const {
+        return PerfGroup().events;
+    }
+
+    static bool isAvailable() {
+        return PerfGroup().isAvailable();
+    }
+
+    bool measurementIsReady() const { return state == State::READY; }
+
+  private:
+    bool markTimers = false;
+    bool traceSpans = false;
+    uint64_t traceBeginNs = 0;
+    size_t traceIteration = 0;
+    std::vector<uint64_t> counts = {};
+
+    enum class State { IDLE,
+                       STARTED,
+                       READY };
+    State state = State::IDLE;
+};
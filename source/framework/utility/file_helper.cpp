@@ -7,8 +7,17 @@
 
 #include "file_helper.h"
 
+#include <cerrno>
+#include <fcntl.h>
 #include <fstream>
 
+#ifdef _WIN32
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <unistd.h>
+#endif
+
 std::vector<uint8_t> FileHelper::loadFile(const std::string &filePath, std::ios_base::openmode openMode) {
     std::ifstream stream(filePath, openMode);
     if (!stream.good()) {
@@ -33,6 +42,42 @@ std::vector<uint8_t> FileHelper::loadTextFile(const std::string &filePath) {
     return loadFile(filePath, std::ios::in);
 }
 
+bool FileHelper::appendToFile(const std::string &filePath, std::string_view text, bool truncate) {
+#ifdef _WIN32
+    const int fd = _open(filePath.c_str(), _O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY | (truncate ? _O_TRUNC : 0), _S_IREAD | _S_IWRITE);
+#else
+    const int fd = open(filePath.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC | (truncate ? O_TRUNC : 0), 0644);
+#endif
+    if (fd < 0) {
+        return false;
+    }
+
+    // Regular files are written in one go, the loop only handles a write cut short by a signal
+    bool success = true;
+    while (!text.empty()) {
+#ifdef _WIN32
+        const auto written = _write(fd, text.data(), static_cast<unsigned int>(text.size()));
+#else
+        const auto written = write(fd, text.data(), text.size());
+#endif
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            success = false;
+            break;
+        }
+        text.remove_prefix(static_cast<size_t>(written));
+    }
+
+#ifdef _WIN32
+    _close(fd);
+#else
+    close(fd);
+#endif
+    return success;
+}
+
 FileHelper::FileOrConsole::FileOrConsole(const std::string &filePath, std::ios::openmode openMode, std::ostream &fallback)
     : fallback(fallback) {
     if (!filePath.empty()) {
@@ -11,6 +11,7 @@
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <string_view>
 #include <vector>
 
 struct FileHelper {
@@ -18,6 +19,11 @@ struct FileHelper {
     static std::vector<uint8_t> loadBinaryFile(const std::string &filePath);
     static std::vector<uint8_t> loadTextFile(const std::string &filePath);
 
+    // Appends text to a file with a single write on a descriptor opened in append mode. Records of
+    // other processes writing the same file do not interleave with it and a crash cannot leave half
+    // of it behind. Pass truncate to start the file from scratch.
+    static bool appendToFile(const std::string &filePath, std::string_view text, bool truncate = false);
+
     class FileOrConsole {
       public:
         FileOrConsole(const std::string &filePath, std::ios::openmode openMode, std::ostream &fallback);
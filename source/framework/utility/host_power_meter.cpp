@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "host_power_meter.h"
+
+#include "framework/utility/tsc_clock.h"
+
+void HostPowerMeter::measureStart() {
+    for (auto zones : {&packageZones, &coreZones}) {
+        for (EnergyZone &zone : *zones) {
+            zone.start = readEnergy(zone, zone.end);
+        }
+    }
+    if (hasEffectiveFrequency()) {
+        aperfStart = readCounter(aperfFd);
+        mperfStart = readCounter(mperfFd);
+    }
+    startTime = std::chrono::steady_clock::now();
+}
+
+void HostPowerMeter::measureEnd() {
+    endTime = std::chrono::steady_clock::now();
+    if (hasEffectiveFrequency()) {
+        aperfEnd = readCounter(aperfFd);
+        mperfEnd = readCounter(mperfFd);
+    }
+    for (auto zones : {&packageZones, &coreZones}) {
+        for (EnergyZone &zone : *zones) {
+            zone.end = readEnergy(zone, zone.start);
+        }
+    }
+}
+
+uint64_t HostPowerMeter::getPackageEnergy() const {
+    return getEnergyDelta(packageZones);
+}
+
+uint64_t HostPowerMeter::getCoreEnergy() const {
+    return getEnergyDelta(coreZones);
+}
+
+double HostPowerMeter::getPackagePower() const {
+    const double seconds = std::chrono::duration<double>(endTime - startTime).count();
+    return seconds > 0 ? static_cast<double>(getPackageEnergy()) / 1e6 / seconds : 0;
+}
+
+double HostPowerMeter::getEffectiveFrequency() const {
+    // Both counters stop while the threads sleep, so the result is the average frequency while running
+    if (mperfEnd <= mperfStart) {
+        return 0;
+    }
+    const double ratio = static_cast<double>(aperfEnd - aperfStart) / static_cast<double>(mperfEnd - mperfStart);
+    return ratio * TscClock::getCalibration().ticksPerNanosecond;
+}
+
+uint64_t HostPowerMeter::getEnergyDelta(const std::vector<EnergyZone> &zones) {
+    uint64_t energy = 0;
+    for (const EnergyZone &zone : zones) {
+        energy += zone.end >= zone.start ? zone.end - zone.start : zone.maxEnergy - zone.start + zone.end;
+    }
+    return energy;
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Host side counterpart of PowerMeter, used by TestCaseStatistics with --measureHostPower. Energy of
+// CPU packages and of their cores is read from RAPL zones in /sys/class/powercap, effective frequency
+// of the process from the APERF and MPERF registers, counted by the msr perf PMU while its threads
+// run. APERF counts at the actual and MPERF at the TSC frequency, so their ratio scales the TSC
+// frequency to the average one. Sources which cannot be read are reported once and skipped, the
+// energy_uj files are readable only by root on recent kernels. Only Linux is supported.
+class HostPowerMeter {
+  public:
+    HostPowerMeter();
+    ~HostPowerMeter();
+    HostPowerMeter(const HostPowerMeter &) = delete;
+    HostPowerMeter &operator=(const HostPowerMeter &) = delete;
+
+    bool isEnabled() const { return hasPackageEnergy() || hasEffectiveFrequency(); }
+    bool hasPackageEnergy() const { return !packageZones.empty(); }
+    bool hasCoreEnergy() const { return !coreZones.empty(); }
+    bool hasEffectiveFrequency() const { return aperfFd != -1 && mperfFd != -1; }
+
+    void measureStart();
+    void measureEnd();
+
+    uint64_t getPackageEnergy() const;    // uJ, summed over all packages
+    uint64_t getCoreEnergy() const;       // uJ, summed over all packages
+    double getPackagePower() const;       // W
+    double getEffectiveFrequency() const; // GHz
+
+  private:
+    struct EnergyZone {
+        int fd;
+        uint64_t maxEnergy; // energy_uj wraps around at max_energy_range_uj
+        uint64_t start;
+        uint64_t end;
+    };
+
+    void openEnergyZones();
+    void openFrequencyCounters();
+    static uint64_t readEnergy(const EnergyZone &zone, uint64_t valueOnFailure);
+    static uint64_t readCounter(int fd);
+    static uint64_t getEnergyDelta(const std::vector<EnergyZone> &zones);
+
+    std::vector<EnergyZone> packageZones;
+    std::vector<EnergyZone> coreZones;
+    int aperfFd = -1;
+    int mperfFd = -1;
+    uint64_t aperfStart = 0;
+    uint64_t aperfEnd = 0;
+    uint64_t mperfStart = 0;
+    uint64_t mperfEnd = 0;
+    std::chrono::steady_clock::time_point startTime = {};
+    std::chrono::steady_clock::time_point endTime = {};
+};
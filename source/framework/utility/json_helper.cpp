@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "json_helper.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
+
+std::string JsonHelper::toString(std::string_view text) {
+    std::ostringstream result;
+    result << '"';
+    for (const char c : text) {
+        switch (c) {
+        case '"':
+            result << "\\\"";
+            break;
+        case '\\':
+            result << "\\\\";
+            break;
+        case '\n':
+            result << "\\n";
+            break;
+        case '\r':
+            result << "\\r";
+            break;
+        case '\t':
+            result << "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                result << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec << std::setfill(' ');
+            } else {
+                result << c;
+            }
+        }
+    }
+    result << '"';
+    return result.str();
+}
+
+std::string JsonHelper::toNumber(double value) {
+    if (!std::isfinite(value)) {
+        return "null";
+    }
+    std::ostringstream result;
+    result << std::setprecision(10) << value;
+    return result.str();
+}
+
+const JsonHelper::Value *JsonHelper::Value::find(std::string_view key) const {
+    if (type != Type::Object) {
+        return nullptr;
+    }
+    const auto it = object.find(key);
+    return it == object.end() ? nullptr : &it->second;
+}
+
+namespace {
+// Recursive descent parser of RFC 8259 JSON, enough for reading back files written by the benchmarks
+class JsonParser {
+  public:
+    explicit JsonParser(std::string_view text) : text(text) {}
+
+    bool parseDocument(JsonHelper::Value &outValue) {
+        if (!parseValue(outValue)) {
+            return false;
+        }
+        skipWhitespace();
+        return position == text.size();
+    }
+
+  private:
+    bool parseValue(JsonHelper::Value &outValue) {
+        skipWhitespace();
+        if (position == text.size()) {
+            return false;
+        }
+        switch (text[position]) {
+        case '{':
+            outValue.type = JsonHelper::Value::Type::Object;
+            return parseObject(outValue);
+        case '[':
+            outValue.type = JsonHelper::Value::Type::Array;
+            return parseArray(outValue);
+        case '"':
+            outValue.type = JsonHelper::Value::Type::String;
+            return parseString(outValue.string);
+        case 't':
+            outValue.type = JsonHelper::Value::Type::Boolean;
+            outValue.boolean = true;
+            return consumeLiteral("true");
+        case 'f':
+            outValue.type = JsonHelper::Value::Type::Boolean;
+            outValue.boolean = false;
+            return consumeLiteral("false");
+        case 'n':
+            outValue.type = JsonHelper::Value::Type::Null;
+            return consumeLiteral("null");
+        default:
+            outValue.type = JsonHelper::Value::Type::Number;
+            return parseNumber(outValue.number);
+        }
+    }
+
+    bool parseObject(JsonHelper::Value &outValue) {
+        position++; // '{'
+        skipWhitespace();
+        if (consume('}')) {
+            return true;
+        }
+        do {
+            skipWhitespace();
+            std::string key{};
+            if (!parseString(key)) {
+                return false;
+            }
+            skipWhitespace();
+            if (!consume(':')) {
+                return false;
+            }
+            if (!parseValue(outValue.object[key])) {
+                return false;
+            }
+            skipWhitespace();
+        } while (consume(','));
+        return consume('}');
+    }
+
+    bool parseArray(JsonHelper::Value &outValue) {
+        position++; // '['
+        skipWhitespace();
+        if (consume(']')) {
+            return true;
+        }
+        do {
+            if (!parseValue(outValue.array.emplace_back())) {
+                return false;
+            }
+            skipWhitespace();
+        } while (consume(','));
+        return consume(']');
+    }
+
+    bool parseString(std::string &outString) {
+        if (!consume('"')) {
+            return false;
+        }
+        while (position < text.size()) {
+            const char c = text[position++];
+            if (c == '"') {
+                return true;
+            }
+            if (c != '\\') {
+                outString += c;
+                continue;
+            }
+            if (position == text.size()) {
+                return false;
+            }
+            switch (const char escaped = text[position++]; escaped) {
+            case '"':
+            case '\\':
+            case '/':
+                outString += escaped;
+                break;
+            case 'b':
+                outString += '\b';
+                break;
+            case 'f':
+                outString += '\f';
+                break;
+            case 'n':
+                outString += '\n';
+                break;
+            case 'r':
+                outString += '\r';
+                break;
+            case 't':
+                outString += '\t';
+                break;
+            case 'u': {
+                if (position + 4 > text.size()) {
+                    return false;
+                }
+                const std::string hex{text.substr(position, 4)};
+                char *end = nullptr;
+                const unsigned long codePoint = std::strtoul(hex.c_str(), &end, 16);
+                if (*end != '\0') {
+                    return false;
+                }
+                position += 4;
+                appendUtf8(outString, codePoint);
+                break;
+            }
+            default:
+                return false;
+            }
+        }
+        return false;
+    }
+
+    bool parseNumber(double &outNumber) {
+        const size_t start = position;
+        while (position < text.size() && std::string_view("+-0123456789.eE").find(text[position]) != std::string_view::npos) {
+            position++;
+        }
+        const std::string number{text.substr(start, position - start)};
+        char *end = nullptr;
+        outNumber = std::strtod(number.c_str(), &end);
+        return !number.empty() && *end == '\0';
+    }
+
+    static void appendUtf8(std::string &outString, unsigned long codePoint) {
+        if (codePoint < 0x80) {
+            outString += static_cast<char>(codePoint);
+        } else if (codePoint < 0x800) {
+            outString += static_cast<char>(0xC0 | (codePoint >> 6));
+            outString += static_cast<char>(0x80 | (codePoint & 0x3F));
+        } else {
+            outString += static_cast<char>(0xE0 | (codePoint >> 12));
+            outString += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            outString += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+    }
+
+    bool consumeLiteral(std::string_view literal) {
+        if (text.substr(position, literal.size()) != literal) {
+            return false;
+        }
+        position += literal.size();
+        return true;
+    }
+
+    bool consume(char c) {
+        if (position < text.size() && text[position] == c) {
+            position++;
+            return true;
+        }
+        return false;
+    }
+
+    void skipWhitespace() {
+        while (position < text.size() && std::string_view(" \t\r\n").find(text[position]) != std::string_view::npos) {
+            position++;
+        }
+    }
+
+    std::string_view text;
+    size_t position = 0;
+};
+} // namespace
+
+bool JsonHelper::parse(std::string_view text, Value &outValue) {
+    outValue = Value{};
+    return JsonParser{text}.parseDocument(outValue);
+}
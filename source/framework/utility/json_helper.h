@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct JsonHelper {
+    // Parsed JSON document. Only the member matching the type is meaningful.
+    struct Value {
+        enum class Type {
+            Null,
+            Boolean,
+            Number,
+            String,
+            Array,
+            Object,
+        };
+
+        Type type = Type::Null;
+        bool boolean = false;
+        double number = 0;
+        std::string string = {};
+        std::vector<Value> array = {};
+        std::map<std::string, Value, std::less<>> object = {};
+
+        // Returns nullptr if this is not an object or it has no such member
+        const Value *find(std::string_view key) const;
+    };
+
+    // Returns the text as a quoted JSON string, with quotes, backslashes and control characters escaped
+    static std::string toString(std::string_view text);
+
+    // JSON has no representation of inf and nan, so non-finite values are written as null
+    static std::string toNumber(double value);
+
+    // Parses a complete JSON document. Returns false on syntax errors or trailing characters.
+    static bool parse(std::string_view text, Value &outValue);
+};
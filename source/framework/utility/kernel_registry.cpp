@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "kernel_registry.h"
+
+#include "framework/configuration.h"
+#include "framework/utility/mapped_file.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace {
+std::mutex mappedFilesMutex;
+std::map<std::string, std::unique_ptr<MappedFile>> mappedFiles;
+} // namespace
+
+std::span<const uint8_t> KernelRegistry::get(const std::string &name) {
+    if (const std::string &kernelDir = Configuration::get().kernelDir; !kernelDir.empty()) {
+        const std::filesystem::path overridePath = std::filesystem::path(kernelDir) / name;
+        std::error_code error;
+        if (std::filesystem::is_regular_file(overridePath, error)) {
+            return mapFile(overridePath.string());
+        }
+    }
+
+    const std::span<const EmbeddedKernel> embeddedKernels = getEmbeddedKernels();
+    const auto embeddedKernel = std::find_if(embeddedKernels.begin(), embeddedKernels.end(), [&name](const EmbeddedKernel &kernel) {
+        return kernel.name == name;
+    });
+    if (embeddedKernel != embeddedKernels.end()) {
+        return embeddedKernel->content;
+    }
+
+    return mapFile(name);
+}
+
+std::span<const uint8_t> KernelRegistry::mapFile(const std::string &filePath) {
+    std::lock_guard lock(mappedFilesMutex);
+    auto &mappedFile = mappedFiles[filePath];
+    if (mappedFile == nullptr || !mappedFile->isOpen()) {
+        mappedFile = std::make_unique<MappedFile>(filePath);
+    }
+    if (!mappedFile->isOpen()) {
+        std::cerr << "ERROR: Failed to open file: " << filePath << ".\n";
+        return {};
+    }
+    return mappedFile->getContent();
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+// Kernel files of source/kernels, built into every benchmark as constant arrays at build time, so
+// getting one does not read or copy a file. With --kernelDir a file of the same name in that
+// directory is used instead, so kernels can be changed without rebuilding. Names of kernels which
+// are not built in, e.g. paths given in a test's arguments, are loaded from the file at that path.
+//
+// Files are mapped into memory, not read, and stay mapped until the process exits, so returned
+// spans are valid for the whole run. Built-in kernels are followed by a null character not counted
+// in their size.
+class KernelRegistry {
+  public:
+    struct EmbeddedKernel {
+        std::string_view name;
+        std::span<const uint8_t> content;
+    };
+
+    // Returns an empty span if there is no kernel of that name
+    static std::span<const uint8_t> get(const std::string &name);
+
+  private:
+    static std::span<const EmbeddedKernel> getEmbeddedKernels(); // generated by cmake/EmbedKernels.cmake
+    static std::span<const uint8_t> mapFile(const std::string &filePath);
+};
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/cpu_time_timer.h"
+
+#include "framework/utility/error.h"
+
+#include <sys/resource.h>
+#include <time.h>
+
+namespace {
+std::chrono::nanoseconds timevalToDuration(const timeval &time) {
+    return std::chrono::seconds(time.tv_sec) + std::chrono::microseconds(time.tv_usec);
+}
+} // namespace
+
+CpuTimeTimer::CpuTimeTimer(Scope scope) : scope(scope) {}
+
+void CpuTimeTimer::measureStart() {
+    start = getCpuTime(scope);
+}
+
+void CpuTimeTimer::measureEnd() {
+    end = getCpuTime(scope);
+}
+
+std::chrono::nanoseconds CpuTimeTimer::get() const {
+    if (end <= start) {
+        return std::chrono::nanoseconds(0);
+    }
+    return end - start;
+}
+
+std::chrono::nanoseconds CpuTimeTimer::getCpuTime(Scope scope) {
+    // CPU-time clocks have nanosecond resolution, getrusage is only a fallback with microsecond resolution
+    timespec time{};
+    if (clock_gettime(scope == Scope::Thread ? CLOCK_THREAD_CPUTIME_ID : CLOCK_PROCESS_CPUTIME_ID, &time) == 0) {
+        return std::chrono::seconds(time.tv_sec) + std::chrono::nanoseconds(time.tv_nsec);
+    }
+
+    rusage usage{};
+    const auto querySucceeded = getrusage(scope == Scope::Thread ? RUSAGE_THREAD : RUSAGE_SELF, &usage) == 0;
+    FATAL_ERROR_IF(!querySucceeded, "CPU time query failed");
+    return timevalToDuration(usage.ru_utime) + timevalToDuration(usage.ru_stime);
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/host_power_meter.h"
+
+#include "framework/utility/working_directory_helper.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace {
+const std::string powercapPath = "/sys/class/powercap";
+const std::string msrPmuPath = "/sys/bus/event_source/devices/msr";
+
+std::string readLine(const std::string &path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+// Event files of the msr PMU look like "event=0x01"
+bool readMsrEventConfig(const std::string &name, uint64_t &config) {
+    const std::string event = readLine(msrPmuPath + "/events/" + name);
+    const size_t equals = event.find('=');
+    if (event.rfind("event", 0) != 0 || equals == std::string::npos) {
+        return false;
+    }
+    config = std::strtoull(event.c_str() + equals + 1, nullptr, 0);
+    return true;
+}
+
+void printUnavailableWarning(bool &warningPrinted, const char *message) {
+    if (!warningPrinted) {
+        std::cerr << "WARNING: " << message << '\n';
+        warningPrinted = true;
+    }
+}
+} // namespace
+
+HostPowerMeter::HostPowerMeter() {
+    openEnergyZones();
+    openFrequencyCounters();
+}
+
+HostPowerMeter::~HostPowerMeter() {
+    for (auto zones : {&packageZones, &coreZones}) {
+        for (EnergyZone &zone : *zones) {
+            close(zone.fd);
+        }
+    }
+    for (int fd : {aperfFd, mperfFd}) {
+        if (fd != -1) {
+            close(fd);
+        }
+    }
+}
+
+void HostPowerMeter::openEnergyZones() {
+    // Packages are the top level zones, e.g. intel-rapl:0 named "package-0", and their cores are one of
+    // the subzones, e.g. intel-rapl:0:0 named "core". AMD CPUs expose the same layout.
+    std::vector<std::string> zonePaths;
+    std::error_code error;
+    for (FileSystem::directory_iterator it(powercapPath, error), end; !error && it != end; it.increment(error)) {
+        const std::string name = it->path().filename().string();
+        if (name.rfind("intel-rapl:", 0) == 0) {
+            zonePaths.push_back(it->path().string());
+        }
+    }
+    std::sort(zonePaths.begin(), zonePaths.end());
+
+    for (const std::string &zonePath : zonePaths) {
+        const std::string zoneName = readLine(zonePath + "/name");
+        const bool isPackage = zoneName.rfind("package", 0) == 0;
+        if (!isPackage && zoneName != "core") {
+            continue;
+        }
+        const int fd = open((zonePath + "/energy_uj").c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1) {
+            continue;
+        }
+        EnergyZone zone{fd, std::strtoull(readLine(zonePath + "/max_energy_range_uj").c_str(), nullptr, 10), 0, 0};
+        (isPackage ? packageZones : coreZones).push_back(zone);
+    }
+
+    static bool warningPrinted = false;
+    if (packageZones.empty()) {
+        printUnavailableWarning(warningPrinted, "cannot read RAPL energy counters from /sys/class/powercap, host energy will not be measured");
+    }
+}
+
+void HostPowerMeter::openFrequencyCounters() {
+    static bool warningPrinted = false;
+    const int pmuType = std::atoi(readLine(msrPmuPath + "/type").c_str());
+    uint64_t aperfConfig = 0;
+    uint64_t mperfConfig = 0;
+    if (pmuType <= 0 || !readMsrEventConfig("aperf", aperfConfig) || !readMsrEventConfig("mperf", mperfConfig)) {
+        printUnavailableWarning(warningPrinted, "APERF and MPERF are not exposed by the msr perf PMU, effective frequency will not be measured");
+        return;
+    }
+
+    // Counted for the calling thread and the threads it creates later
+    auto openCounter = [pmuType](uint64_t config) {
+        perf_event_attr attributes{};
+        attributes.type = static_cast<uint32_t>(pmuType);
+        attributes.size = sizeof(attributes);
+        attributes.config = config;
+        attributes.inherit = 1;
+        return static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0));
+    };
+    aperfFd = openCounter(aperfConfig);
+    mperfFd = openCounter(mperfConfig);
+    if (!hasEffectiveFrequency()) {
+        printUnavailableWarning(warningPrinted, "cannot open APERF and MPERF perf events, effective frequency will not be measured");
+        for (int *fd : {&aperfFd, &mperfFd}) {
+            if (*fd != -1) {
+                close(*fd);
+                *fd = -1;
+            }
+        }
+    }
+}
+
+uint64_t HostPowerMeter::readEnergy(const EnergyZone &zone, uint64_t valueOnFailure) {
+    // A failed read must not look like a wrap around of the counter
+    char buffer[32] = {};
+    if (pread(zone.fd, buffer, sizeof(buffer) - 1, 0) <= 0) {
+        return valueOnFailure;
+    }
+    return std::strtoull(buffer, nullptr, 10);
+}
+
+uint64_t HostPowerMeter::readCounter(int fd) {
+    uint64_t value = 0;
+    if (read(fd, &value, sizeof(value)) != sizeof(value)) {
+        return 0;
+    }
+    return value;
+}
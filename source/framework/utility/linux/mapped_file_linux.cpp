@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string &filePath) {
+    const int fd = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return;
+    }
+
+    struct stat fileStatus {};
+    if (fstat(fd, &fileStatus) == 0 && S_ISREG(fileStatus.st_mode)) {
+        // An empty file cannot be mapped, but is open nonetheless
+        const size_t fileSize = static_cast<size_t>(fileStatus.st_size);
+        void *mapping = fileSize > 0 ? mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0) : nullptr;
+        if (mapping != MAP_FAILED) {
+            this->data = static_cast<const uint8_t *>(mapping);
+            this->size = fileSize;
+            this->open = true;
+        }
+    }
+    close(fd);
+}
+
+MappedFile::~MappedFile() {
+    if (data != nullptr) {
+        munmap(const_cast<uint8_t *>(data), size);
+    }
+}
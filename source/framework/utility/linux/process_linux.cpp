@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,11 +10,16 @@
 #include "framework/utility/process.h"
 #include "framework/utility/process_synchronization_helper.h"
 
+#include <cerrno>
+#include <csignal>
+#include <cstring>
 #include <fcntl.h>
 #include <memory>
+#include <poll.h>
 #include <sstream>
 #include <sys/types.h>
 #include <sys/wait.h>
+#include <thread>
 #include <unistd.h>
 
 struct ProcessDataLinux {
@@ -35,6 +40,7 @@ struct ProcessDataLinux {
     std::string stdOut = {};
     bool hasMeasurements = false;
     std::string measurements = {};
+    std::string terminationReason = {};
 };
 
 void Process::run() {
@@ -75,9 +81,11 @@ void Process::run() {
         FATAL_ERROR_IF_SYS_CALL_FAILED(close(processDataLinux->stdOutPipe.read), "closing pipe failed");
 
         // Below pipe endpoints will be explicitly used by the child workload and they should be closed by it.
-        this->addArgument("synchronizationPipeIn", std::to_string(processDataLinux->synchronizationPipeParentToChild.read));
-        this->addArgument("synchronizationPipeOut", std::to_string(processDataLinux->synchronizationPipeChildToParent.write));
-        this->addArgument("measurementPipe", std::to_string(processDataLinux->measurementPipe.write));
+        if (this->synchronizationArguments) {
+            this->addArgument("synchronizationPipeIn", std::to_string(processDataLinux->synchronizationPipeParentToChild.read));
+            this->addArgument("synchronizationPipeOut", std::to_string(processDataLinux->synchronizationPipeChildToParent.write));
+            this->addArgument("measurementPipe", std::to_string(processDataLinux->measurementPipe.write));
+        }
 
         // Prepare arguments
         std::vector<std::string> argumentsForExecStrings = {};
@@ -127,6 +135,7 @@ void Process::freeOsSpecificData() {
     FATAL_ERROR_IF_SYS_CALL_FAILED(close(processDataLinux->synchronizationPipeParentToChild.write), "closing pipe failed");
     FATAL_ERROR_IF_SYS_CALL_FAILED(close(processDataLinux->synchronizationPipeChildToParent.read), "closing pipe failed");
     FATAL_ERROR_IF_SYS_CALL_FAILED(close(processDataLinux->measurementPipe.read), "closing pipe failed");
+    FATAL_ERROR_IF_SYS_CALL_FAILED(close(processDataLinux->stdOutPipe.read), "closing pipe failed");
 
     delete processDataLinux;
 }
@@ -154,6 +163,84 @@ void Process::waitForFinish() {
     processDataLinux->ended = true;
 }
 
+bool Process::waitForFinishOrKill(std::chrono::milliseconds timeout) {
+    ProcessDataLinux *processDataLinux = static_cast<ProcessDataLinux *>(this->osSpecificData);
+    FATAL_ERROR_IF(processDataLinux->ended || processDataLinux->hasStdOut, "Process was already waited for");
+
+    const bool isLimited = timeout.count() > 0;
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    auto getRemainingMilliseconds = [&]() {
+        const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        return std::max(remaining.count(), static_cast<decltype(remaining.count())>(0));
+    };
+
+    // Stdout is drained while waiting, a child filling the pipe would never finish otherwise
+    std::ostringstream output{};
+    bool timedOut = false;
+    while (!timedOut) {
+        pollfd stdOutPoll{processDataLinux->stdOutPipe.read, POLLIN, 0};
+        const int readyCount = poll(&stdOutPoll, 1, isLimited ? static_cast<int>(getRemainingMilliseconds()) : -1);
+        if (readyCount == -1 && errno == EINTR) {
+            continue;
+        }
+        FATAL_ERROR_IF_SYS_CALL_FAILED(readyCount, "polling a child process pipe failed");
+        if (readyCount == 0) {
+            timedOut = true;
+            break;
+        }
+
+        char buffer[1024];
+        const ssize_t numberOfBytesRead = read(processDataLinux->stdOutPipe.read, buffer, sizeof(buffer));
+        if (numberOfBytesRead == -1 && errno == EINTR) {
+            continue;
+        }
+        FATAL_ERROR_IF_SYS_CALL_FAILED(numberOfBytesRead, "reading a child process pipe failed");
+        if (numberOfBytesRead == 0) {
+            break;
+        }
+        output << std::string{buffer, static_cast<size_t>(numberOfBytesRead)};
+    }
+
+    // The pipe is closed once the child exits, unless it was passed on to processes it started
+    int status{};
+    pid_t pid = 0;
+    while (!timedOut) {
+        pid = waitpid(processDataLinux->childPid, &status, WNOHANG);
+        FATAL_ERROR_IF(pid == -1 && errno != EINTR, std::string("waitpid() returned an error, ") + getErrorFromErrno());
+        if (pid == processDataLinux->childPid) {
+            break;
+        }
+        timedOut = isLimited && getRemainingMilliseconds() == 0;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    if (timedOut) {
+        FATAL_ERROR_IF_SYS_CALL_FAILED(kill(processDataLinux->childPid, SIGKILL), "killing a child process failed");
+        do {
+            pid = waitpid(processDataLinux->childPid, &status, 0);
+        } while (pid == -1 && errno == EINTR);
+        FATAL_ERROR_IF(pid == -1, std::string("waitpid() returned an error, ") + getErrorFromErrno());
+    }
+
+    if (timedOut) {
+        processDataLinux->result = TestResult::Error;
+        processDataLinux->terminationReason = "timed out after " + std::to_string(timeout.count()) + "ms";
+    } else if (WIFSIGNALED(status)) {
+        processDataLinux->result = TestResult::Error;
+        processDataLinux->terminationReason = "killed by signal " + std::to_string(WTERMSIG(status)) + " (" + strsignal(WTERMSIG(status)) + ")";
+    } else {
+        processDataLinux->result = static_cast<TestResult>(WEXITSTATUS(status));
+    }
+    processDataLinux->stdOut = output.str();
+    processDataLinux->hasStdOut = true;
+    processDataLinux->ended = true;
+    return !timedOut;
+}
+
+const std::string &Process::getTerminationReason() {
+    ProcessDataLinux *processDataLinux = static_cast<ProcessDataLinux *>(this->osSpecificData);
+    return processDataLinux->terminationReason;
+}
+
 TestResult Process::getResult() {
     waitForFinish();
     ProcessDataLinux *processDataLinux = static_cast<ProcessDataLinux *>(this->osSpecificData);
@@ -182,9 +269,10 @@ const std::string &Process::getStdout() {
     ProcessDataLinux *processDataLinux = static_cast<ProcessDataLinux *>(this->osSpecificData);
 
     if (!processDataLinux->hasStdOut) {
-        waitForFinish();
+        // Read before waiting, a child writing more than the pipe can hold would never finish otherwise
         processDataLinux->stdOut = readEntirePipe(processDataLinux->stdOutPipe);
         processDataLinux->hasStdOut = true;
+        waitForFinish();
     }
 
     return processDataLinux->stdOut;
@@ -0,0 +1,30 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+// Read-only mapping of a whole file into memory, unmapped on destruction
+class MappedFile {
+  public:
+    explicit MappedFile(const std::string &filePath); // OS-specific implementation
+    ~MappedFile();                                    // OS-specific implementation
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    bool isOpen() const { return open; }
+    std::span<const uint8_t> getContent() const { return {data, size}; }
+
+  private:
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    bool open = false;
+};
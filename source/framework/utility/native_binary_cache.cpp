@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "native_binary_cache.h"
+
+#include "framework/configuration.h"
+#include "framework/utility/file_helper.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <random>
+#include <sstream>
+
+namespace {
+struct Entry {
+    NativeBinaryCache::Binary binary;
+    std::chrono::nanoseconds compileTime;
+};
+
+std::mutex cacheMutex;
+std::map<std::string, Entry> entries;
+size_t hitCount = 0;
+size_t missCount = 0;
+std::chrono::nanoseconds totalSavedTime{};
+std::chrono::nanoseconds totalCompileTime{};
+
+// Files start with the time the compilation took, so hits of later runs know what they saved
+using FileHeader = int64_t;
+
+const std::string &getDirectory() {
+    return Configuration::get().moduleCacheDir;
+}
+
+std::filesystem::path getFilePath(const std::string &key) {
+    return std::filesystem::path(getDirectory()) / (key + ".bin");
+}
+
+uint64_t hashFnv1a(uint64_t hash, const void *data, size_t size) {
+    const auto *bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+bool loadFromDisk(const std::string &key, Entry &outEntry) {
+    const std::filesystem::path path = getFilePath(key);
+    std::error_code error;
+    if (!std::filesystem::exists(path, error)) {
+        return false;
+    }
+    const std::vector<uint8_t> content = FileHelper::loadBinaryFile(path.string());
+    if (content.size() <= sizeof(FileHeader)) {
+        return false;
+    }
+    FileHeader header{};
+    std::memcpy(&header, content.data(), sizeof(header));
+    outEntry.binary = std::make_shared<const std::vector<uint8_t>>(content.begin() + sizeof(header), content.end());
+    outEntry.compileTime = std::chrono::nanoseconds(header);
+    return true;
+}
+
+// Written to a file of a unique name first and renamed, so other processes never read half of it
+void storeOnDisk(const std::string &key, const Entry &entry) {
+    std::error_code error;
+    std::filesystem::create_directories(getDirectory(), error);
+
+    const std::filesystem::path path = getFilePath(key);
+    std::filesystem::path temporaryPath = path;
+    temporaryPath += "." + std::to_string(std::random_device{}()) + ".tmp";
+    {
+        std::ofstream file(temporaryPath, std::ios::out | std::ios::binary | std::ios::trunc);
+        const FileHeader header = entry.compileTime.count();
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char *>(entry.binary->data()), static_cast<std::streamsize>(entry.binary->size()));
+        if (!file.good()) {
+            file.close();
+            std::filesystem::remove(temporaryPath, error);
+            std::cerr << "WARNING: Failed to write module cache file " << path.string() << '\n';
+            return;
+        }
+    }
+    std::filesystem::rename(temporaryPath, path, error);
+    if (error) {
+        std::filesystem::remove(temporaryPath, error);
+    }
+}
+
+std::string toSeconds(std::chrono::nanoseconds time) {
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(3) << std::chrono::duration<double>(time).count() << "s";
+    return stream.str();
+}
+} // namespace
+
+bool NativeBinaryCache::isEnabled() {
+    // Candidates of --autotune mostly differ in launch parameters, not in their kernels
+    return Configuration::get().moduleCache || !getDirectory().empty() || !Configuration::get().autotune.get().empty();
+}
+
+std::string NativeBinaryCache::getKey(const void *input, size_t inputSize, const std::string &device, const char *buildOptions) {
+    const std::string options = buildOptions != nullptr ? buildOptions : "";
+    const size_t sizes[] = {inputSize, device.size(), options.size()};
+
+    uint64_t hash = 0xcbf29ce484222325ull;
+    hash = hashFnv1a(hash, sizes, sizeof(sizes));
+    hash = hashFnv1a(hash, input, inputSize);
+    hash = hashFnv1a(hash, device.data(), device.size());
+    hash = hashFnv1a(hash, options.data(), options.size());
+
+    std::ostringstream key;
+    key << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return key.str();
+}
+
+NativeBinaryCache::Binary NativeBinaryCache::find(const std::string &key) {
+    std::lock_guard lock(cacheMutex);
+    if (auto it = entries.find(key); it != entries.end()) {
+        return it->second.binary;
+    }
+    if (Entry entry; !getDirectory().empty() && loadFromDisk(key, entry)) {
+        return entries.emplace(key, std::move(entry)).first->second.binary;
+    }
+    return nullptr;
+}
+
+void NativeBinaryCache::recordHit(const std::string &key) {
+    std::lock_guard lock(cacheMutex);
+    hitCount++;
+    if (auto it = entries.find(key); it != entries.end()) {
+        totalSavedTime += it->second.compileTime;
+    }
+}
+
+void NativeBinaryCache::recordMiss(const std::string &key, std::vector<uint8_t> binary, std::chrono::nanoseconds compileTime) {
+    std::lock_guard lock(cacheMutex);
+    missCount++;
+    totalCompileTime += compileTime;
+    if (binary.empty()) {
+        return;
+    }
+
+    Entry &entry = entries[key];
+    entry.binary = std::make_shared<const std::vector<uint8_t>>(std::move(binary));
+    entry.compileTime = compileTime;
+    if (!getDirectory().empty()) {
+        storeOnDisk(key, entry);
+    }
+}
+
+std::string NativeBinaryCache::renderReport() {
+    std::lock_guard lock(cacheMutex);
+    std::ostringstream report;
+    report << "Module cache: " << hitCount << " hits, " << missCount << " misses, "
+           << toSeconds(totalCompileTime) << " spent compiling, " << toSeconds(totalSavedTime) << " of compilation saved\n";
+    return report.str();
+}
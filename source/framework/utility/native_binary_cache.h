@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Native binaries of modules and programs built by the framework's kernel helpers, kept with
+// --moduleCache or --autotune, so building the same input for the same device with the same options creates the
+// module from its binary instead of compiling it again. Binaries are kept in memory for the rest
+// of the process and, with --moduleCacheDir, in files of that directory, shared with later runs
+// and with the processes of --jobs and --isolate.
+//
+// The key covers the input (SPIR-V or source), the device with its driver version and the build
+// options, so a binary is not given to a driver it was not built by. A binary the driver rejects
+// anyway is compiled again and replaced.
+class NativeBinaryCache {
+  public:
+    using Binary = std::shared_ptr<const std::vector<uint8_t>>;
+
+    static bool isEnabled();
+    static std::string getKey(const void *input, size_t inputSize, const std::string &device, const char *buildOptions);
+
+    // Returns nullptr if there is no binary for the key, neither in memory nor on disk
+    static Binary find(const std::string &key);
+
+    // Counts a module created from the binary of the key, saving the time its compilation took
+    static void recordHit(const std::string &key);
+
+    // Counts a compilation and keeps its binary for the key, unless it is empty
+    static void recordMiss(const std::string &key, std::vector<uint8_t> binary, std::chrono::nanoseconds compileTime);
+
+    static std::string renderReport();
+};
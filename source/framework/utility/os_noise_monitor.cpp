@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "os_noise_monitor.h"
+
+#include "framework/configuration.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <vector>
+
+#ifndef _WIN32
+#include <linux/perf_event.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+using Counters = OsNoiseMonitor::Counters;
+
+struct RegionTotals {
+    std::atomic<uint64_t> regions = 0;
+    std::atomic<uint64_t> preemptedRegions = 0;
+    std::atomic<uint64_t> involuntarySwitches = 0;
+    std::atomic<uint64_t> voluntarySwitches = 0;
+    std::atomic<uint64_t> migrations = 0;
+    std::atomic<uint64_t> minorFaults = 0;
+    std::atomic<uint64_t> majorFaults = 0;
+};
+RegionTotals regionTotals;
+std::atomic<bool> preemptionPending = false;
+
+Counters testStartCounters;
+std::map<std::string, uint64_t> testStartInterrupts;
+bool migrationsAvailable = true;
+
+#ifndef _WIN32
+// Migrations are not reported by getrusage, they come from a software perf event of each thread
+struct MigrationCounter {
+    MigrationCounter() {
+        perf_event_attr attributes{};
+        attributes.type = PERF_TYPE_SOFTWARE;
+        attributes.size = sizeof(attributes);
+        attributes.config = PERF_COUNT_SW_CPU_MIGRATIONS;
+        fd = static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0));
+        if (fd == -1) {
+            migrationsAvailable = false;
+        }
+    }
+    ~MigrationCounter() {
+        if (fd != -1) {
+            close(fd);
+        }
+    }
+    uint64_t read() const {
+        uint64_t value = 0;
+        if (fd != -1 && ::read(fd, &value, sizeof(value)) != sizeof(value)) {
+            value = 0;
+        }
+        return value;
+    }
+    int fd = -1;
+};
+
+Counters getCounters(int who, uint64_t migrations) {
+    rusage usage{};
+    getrusage(who, &usage);
+    Counters counters{};
+    counters.involuntarySwitches = static_cast<uint64_t>(usage.ru_nivcsw);
+    counters.voluntarySwitches = static_cast<uint64_t>(usage.ru_nvcsw);
+    counters.minorFaults = static_cast<uint64_t>(usage.ru_minflt);
+    counters.majorFaults = static_cast<uint64_t>(usage.ru_majflt);
+    counters.migrations = migrations;
+    return counters;
+}
+
+Counters getThreadCounters() {
+    thread_local MigrationCounter migrationCounter{};
+    return getCounters(RUSAGE_THREAD, migrationCounter.read());
+}
+
+// /proc/self/sched describes the main thread and needs CONFIG_SCHED_DEBUG, 0 if it is missing
+uint64_t getMainThreadMigrations() {
+    std::ifstream file("/proc/self/sched");
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.rfind("se.nr_migrations", 0) == 0) {
+            const size_t colon = line.find(':');
+            return colon == std::string::npos ? 0 : std::strtoull(line.c_str() + colon + 1, nullptr, 10);
+        }
+    }
+    return 0;
+}
+
+// Summed over all CPUs, keyed by the IRQ number and its description
+std::map<std::string, uint64_t> getInterrupts() {
+    std::map<std::string, uint64_t> interrupts;
+    std::ifstream file("/proc/interrupts");
+    std::string line;
+    std::getline(file, line); // CPU0 CPU1 ...
+    while (std::getline(file, line)) {
+        std::istringstream stream(line);
+        std::string irq;
+        if (!(stream >> irq) || irq.back() != ':') {
+            continue;
+        }
+        uint64_t total = 0;
+        std::string token;
+        std::streampos descriptionStart = stream.tellg();
+        while (stream >> token && std::all_of(token.begin(), token.end(), [](char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; })) {
+            total += std::strtoull(token.c_str(), nullptr, 10);
+            descriptionStart = stream.tellg();
+        }
+        // Numbered IRQs are named after the device, the last word of the line, e.g. "29:nvme0q1".
+        // The others, e.g. "LOC:" for local timer interrupts, are known by their short name.
+        irq.pop_back();
+        if (std::isdigit(static_cast<unsigned char>(irq[0])) && descriptionStart != std::streampos(-1)) {
+            const size_t lastSpace = line.find_last_of(' ');
+            if (lastSpace != std::string::npos && lastSpace + 1 < line.size()) {
+                irq += ":" + line.substr(lastSpace + 1);
+            }
+        }
+        interrupts[irq] += total;
+    }
+    return interrupts;
+}
+#else
+Counters getThreadCounters() {
+    return {};
+}
+Counters getCounters(int, uint64_t) {
+    return {};
+}
+uint64_t getMainThreadMigrations() {
+    return 0;
+}
+std::map<std::string, uint64_t> getInterrupts() {
+    return {};
+}
+constexpr int RUSAGE_SELF = 0;
+#endif
+
+Counters getProcessCounters() {
+    return getCounters(RUSAGE_SELF, getMainThreadMigrations());
+}
+
+thread_local Counters regionStart{};
+} // namespace
+
+bool OsNoiseMonitor::isEnabled() {
+    return Configuration::get().monitorOsNoise || Configuration::get().dropPreemptedSamples;
+}
+
+void OsNoiseMonitor::measureStart() {
+    regionStart = getThreadCounters();
+}
+
+void OsNoiseMonitor::measureEnd() {
+    const Counters end = getThreadCounters();
+    const uint64_t involuntarySwitches = end.involuntarySwitches - regionStart.involuntarySwitches;
+    const uint64_t migrations = end.migrations - regionStart.migrations;
+    regionTotals.regions.fetch_add(1, std::memory_order_relaxed);
+    regionTotals.involuntarySwitches.fetch_add(involuntarySwitches, std::memory_order_relaxed);
+    regionTotals.voluntarySwitches.fetch_add(end.voluntarySwitches - regionStart.voluntarySwitches, std::memory_order_relaxed);
+    regionTotals.migrations.fetch_add(migrations, std::memory_order_relaxed);
+    regionTotals.minorFaults.fetch_add(end.minorFaults - regionStart.minorFaults, std::memory_order_relaxed);
+    regionTotals.majorFaults.fetch_add(end.majorFaults - regionStart.majorFaults, std::memory_order_relaxed);
+    if (involuntarySwitches > 0 || migrations > 0) {
+        regionTotals.preemptedRegions.fetch_add(1, std::memory_order_relaxed);
+        preemptionPending.store(true, std::memory_order_relaxed);
+    }
+}
+
+bool OsNoiseMonitor::isPreemptionPending() {
+    return preemptionPending.load(std::memory_order_relaxed);
+}
+
+bool OsNoiseMonitor::consumePreemption() {
+    return preemptionPending.exchange(false, std::memory_order_relaxed);
+}
+
+void OsNoiseMonitor::startTest() {
+    if (!isEnabled()) {
+        return;
+    }
+    regionTotals.regions = 0;
+    regionTotals.preemptedRegions = 0;
+    regionTotals.involuntarySwitches = 0;
+    regionTotals.voluntarySwitches = 0;
+    regionTotals.migrations = 0;
+    regionTotals.minorFaults = 0;
+    regionTotals.majorFaults = 0;
+    preemptionPending = false;
+    testStartCounters = getProcessCounters();
+    testStartInterrupts = getInterrupts();
+}
+
+std::string OsNoiseMonitor::renderReport(const std::string &testCaseName, bool iterationsMarked, size_t preemptedIterations, size_t droppedValues) {
+#ifdef _WIN32
+    (void)testCaseName;
+    (void)iterationsMarked;
+    (void)preemptedIterations;
+    (void)droppedValues;
+    return "OS noise monitoring is not supported on Windows\n";
+#else
+    const Counters testEnd = getProcessCounters();
+    std::vector<std::pair<std::string, uint64_t>> interrupts;
+    uint64_t totalInterrupts = 0;
+    for (const auto &[name, count] : getInterrupts()) {
+        const auto start = testStartInterrupts.find(name);
+        const uint64_t delta = count - (start == testStartInterrupts.end() ? 0 : std::min(start->second, count));
+        if (delta > 0) {
+            interrupts.emplace_back(name, delta);
+            totalInterrupts += delta;
+        }
+    }
+    std::sort(interrupts.begin(), interrupts.end(), [](const auto &a, const auto &b) { return a.second > b.second; });
+
+    auto printCounters = [](std::ostringstream &out, uint64_t involuntary, uint64_t voluntary, const std::string &migrations, uint64_t minorFaults, uint64_t majorFaults) {
+        out << "involuntary switches: " << involuntary << "  voluntary switches: " << voluntary << "  migrations: " << migrations
+            << "  minor faults: " << minorFaults << "  major faults: " << majorFaults << "\n";
+    };
+
+    const uint64_t regions = regionTotals.regions;
+    std::ostringstream out;
+    out << "OS noise: " << testCaseName << "\n";
+    out << "  measured regions: " << regions << "  preempted: " << regionTotals.preemptedRegions;
+    if (regions > 0) {
+        out << " (" << std::fixed << std::setprecision(2) << 100.0 * static_cast<double>(regionTotals.preemptedRegions) / static_cast<double>(regions) << "%)";
+    }
+    if (iterationsMarked) {
+        out << "  preempted iterations: " << preemptedIterations << "  dropped values: " << droppedValues << "\n";
+    } else {
+        out << "  preempted iterations: n/a, the benchmark does not mark its iterations\n";
+    }
+    out << "  in measured regions: ";
+    printCounters(out, regionTotals.involuntarySwitches, regionTotals.voluntarySwitches,
+                  migrationsAvailable ? std::to_string(regionTotals.migrations) : "n/a", regionTotals.minorFaults, regionTotals.majorFaults);
+    out << "  whole test:          ";
+    printCounters(out, testEnd.involuntarySwitches - testStartCounters.involuntarySwitches, testEnd.voluntarySwitches - testStartCounters.voluntarySwitches,
+                  std::to_string(testEnd.migrations - testStartCounters.migrations) + " (main thread)",
+                  testEnd.minorFaults - testStartCounters.minorFaults, testEnd.majorFaults - testStartCounters.majorFaults);
+    out << "  interrupts: " << totalInterrupts;
+    constexpr size_t topInterrupts = 5;
+    for (size_t i = 0; i < std::min(interrupts.size(), topInterrupts); i++) {
+        out << (i == 0 ? "  top: " : ", ") << interrupts[i].first << " " << interrupts[i].second;
+    }
+    out << "\n";
+    return out.str();
+#endif
+}
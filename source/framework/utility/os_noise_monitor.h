@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Tells scheduler noise apart from driver cost, with --monitorOsNoise. Timer snapshots context
+// switches and page faults of the measuring thread (getrusage) and its CPU migrations (perf software
+// event) around each measured region. A region with an involuntary context switch or a migration is
+// marked as preempted - voluntary switches are not, since blocking waits are part of what is measured.
+// For benchmarks marking their iterations with Statistics::endIteration, TestCaseStatistics tags each
+// iteration with it and, with --dropPreemptedSamples, leaves the values of preempted iterations out
+// of the statistics.
+//
+// For the whole test the process-wide counters, migrations of the main thread (/proc/self/sched) and
+// interrupts handled by the host (/proc/interrupts) are also reported. Only Linux is supported.
+class OsNoiseMonitor {
+  public:
+    struct Counters {
+        uint64_t involuntarySwitches = 0;
+        uint64_t voluntarySwitches = 0;
+        uint64_t migrations = 0;
+        uint64_t minorFaults = 0;
+        uint64_t majorFaults = 0;
+    };
+
+    static bool isEnabled();
+
+    // Called by Timer on the measuring thread, outside of the measured region
+    static void measureStart();
+    static void measureEnd();
+
+    // Whether any region measured since the previous consumePreemption call was preempted
+    static bool isPreemptionPending();
+    static bool consumePreemption();
+
+    static void startTest();
+    static std::string renderReport(const std::string &testCaseName, bool iterationsMarked, size_t preemptedIterations, size_t droppedValues);
+};
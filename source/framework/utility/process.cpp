@@ -21,7 +21,8 @@ Process::Process(Process &&other)
     : exeName(std::move(other.exeName)),
       arguments(std::move(other.arguments)),
       envVariables(std::move(other.envVariables)),
-      osSpecificData(std::move(other.osSpecificData)) {
+      osSpecificData(std::move(other.osSpecificData)),
+      synchronizationArguments(other.synchronizationArguments) {
     other.osSpecificData = nullptr;
 }
 
@@ -31,6 +32,7 @@ Process &Process::operator=(Process &&other) {
         arguments = std::move(other.arguments);
         envVariables = std::move(other.envVariables);
         osSpecificData = std::move(other.osSpecificData);
+        synchronizationArguments = other.synchronizationArguments;
         other.osSpecificData = nullptr;
     }
     return *this;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 
 #include "framework/test_case/test_result.h"
 
+#include <chrono>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -25,6 +26,7 @@ class Process {
     void addEnvVariable(const std::string &key, const std::string &value);
     void addHandleForInheritance(int handle);
     void setName(const std::string &string) { this->processName = string; }
+    void setSynchronizationArguments(bool enabled) { this->synchronizationArguments = enabled; } // pipes passed to workloads
 
     // Getters
     std::vector<uint64_t> getMeasurements(size_t expectedCount);
@@ -34,6 +36,12 @@ class Process {
     void run();
     void waitForFinish();
     TestResult getResult();
+
+    // Waits for the process, collecting its stdout, and kills it once the timeout passes. A zero
+    // timeout waits without a limit. Unlike waitForFinish, a process killed or crashed is not a fatal
+    // error - its result is TestResult::Error and the cause is given by getTerminationReason.
+    bool waitForFinishOrKill(std::chrono::milliseconds timeout);
+    const std::string &getTerminationReason();
     const std::string &getMeasurements();
     const std::string &getStdout();
     void synchronizationSignal();
@@ -48,4 +56,5 @@ class Process {
     std::vector<int> handlesForInheritance;
     void *osSpecificData = nullptr;
     std::string processName = "";
+    bool synchronizationArguments = true;
 };
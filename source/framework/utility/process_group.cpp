@@ -74,12 +74,13 @@ void ProcessGroup::pushMeasurementsToStatistics(size_t expectedCount,
 
     for (Process &process : processes) {
         const auto measurementsFromProcesses = process.getMeasurements(expectedCount);
+        const auto processMetric = pushIndividualProcessesMeasurements ? statistics.registerMetric(unit, type, process.getName()) : Statistics::MetricHandle{};
 
         for (auto measurementIndex = 0u; measurementIndex < measurementsFromProcesses.size(); measurementIndex++) {
             const auto &measurement = measurementsFromProcesses[measurementIndex];
 
             if (pushIndividualProcessesMeasurements) {
-                statistics.pushValue(std::chrono::nanoseconds(measurement), unit, type, process.getName());
+                statistics.pushValue(processMetric, std::chrono::nanoseconds(measurement));
             }
 
             if (pushAveragedMeasurements) {
@@ -89,9 +90,10 @@ void ProcessGroup::pushMeasurementsToStatistics(size_t expectedCount,
     }
 
     if (pushAveragedMeasurements) {
+        const auto averagedMetric = statistics.registerMetric(unit, type);
         for (auto &averagedMeasurement : averagedMeasurements) {
             averagedMeasurement /= processes.size();
-            statistics.pushValue(std::chrono::nanoseconds(averagedMeasurement), unit, type);
+            statistics.pushValue(averagedMetric, std::chrono::nanoseconds(averagedMeasurement));
         }
     }
 }
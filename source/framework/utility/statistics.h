@@ -17,6 +17,7 @@
 class Statistics {
   public:
     using Clock = std::chrono::high_resolution_clock;
+    using MetricHandle = size_t;
 
     Statistics(size_t maxSamplesCount) : maxSamplesCount(maxSamplesCount) {}
 
@@ -24,13 +25,32 @@ class Statistics {
     virtual void pushValue(Clock::duration time, MeasurementUnit unit, MeasurementType type, std::string_view description = "") = 0;
     virtual void pushValue(Clock::duration time, uint64_t size, MeasurementUnit unit, MeasurementType type, std::string_view description = "") = 0;
     virtual void pushCpuCounter(uint64_t count, MeasurementUnit unit, MeasurementType type, std::string_view description = "") = 0;
+    virtual void pushRatio(double value, MeasurementUnit unit, MeasurementType type, std::string_view description = "") = 0;
     virtual void pushEnergy(size_t microJoules, MeasurementUnit unit, MeasurementType type, std::string_view description = "") = 0;
     virtual void pushEnergy(double watts, MeasurementUnit unit, MeasurementType type, std::string_view description = "") = 0;
     virtual void pushUnitAndType(MeasurementUnit unit, MeasurementType type) = 0;
 
+    // Metrics pushed in every iteration can be registered once before the measurement loop. Pushing
+    // through the returned handle is an indexed append, without looking up the description string
+    // or checking the unit and type again.
+    virtual MetricHandle registerMetric(MeasurementUnit unit, MeasurementType type, std::string_view description = "") = 0;
+    virtual void pushValue(MetricHandle metric, Clock::duration time) = 0;
+    virtual void pushValue(MetricHandle metric, Clock::duration time, uint64_t size) = 0;
+    virtual void pushPercentage(MetricHandle metric, double value) = 0;
+
     virtual bool isEmpty() const = 0;
     virtual bool isFull() const = 0;
 
+    // Benchmarks may loop on this instead of arguments.iterations. It returns false once enough
+    // samples were gathered - either the fixed amount or, with --targetRelativeError, as soon
+    // as the results are precise enough.
+    virtual bool needsMoreSamples() const = 0;
+
+    // Benchmarks pushing their results in the measurement loop may call this at the end of each
+    // iteration. Per-iteration cpu utilization of --measureCpuTime and tagging of values preempted
+    // by the OS rely on it, benchmarks which do not mark their iterations get whole-test values.
+    virtual void endIteration() {}
+
   protected:
     const size_t maxSamplesCount = 0;
 };
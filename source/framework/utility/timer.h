@@ -6,9 +6,13 @@
  */
 
 #pragma once
+#include <algorithm>
 #include <chrono>
 #include <cstdio>
 #include <framework/configuration.h>
+#include <framework/utility/os_noise_monitor.h>
+#include <framework/utility/trace_recorder.h>
+#include <framework/utility/tsc_clock.h>
 #if defined(__ARM_ARCH)
 #include <sse2neon.h>
 #else
@@ -21,6 +25,12 @@ class Timer {
         if (Configuration::get().markTimers) {
             markTimers = true;
         }
+        if (Configuration::get().profilerType == ProfilerType::Tsc) {
+            useTsc = true;
+            subtractedTicks = Configuration::get().subtractTimerOverhead ? TscClock::getCalibration().overheadTicks : 0;
+        }
+        traceSpans = TraceRecorder::isEnabled();
+        monitorOsNoise = OsNoiseMonitor::isEnabled();
     }
     using Clock = std::chrono::high_resolution_clock;
 
@@ -33,6 +43,17 @@ class Timer {
             FATAL_ERROR("Timer measureStart called twice without measureEnd in the middle\n");
         }
         state = State::STARTED;
+        if (monitorOsNoise) {
+            OsNoiseMonitor::measureStart();
+        }
+        if (traceSpans) {
+            traceBeginNs = TraceRecorder::now();
+        }
+
+        if (useTsc) {
+            startTicks = TscClock::read();
+            return;
+        }
 
         // make sure that any pending instructions are done and all memory transactions committed.
         _mm_mfence();
@@ -42,21 +63,37 @@ class Timer {
     }
 
     void measureEnd() {
-        // make sure that any pending instructions are done and all memory transactions committed.
-        _mm_mfence();
-        _mm_lfence();
-        endTime = Clock::now();
+        if (useTsc) {
+            endTicks = TscClock::read();
+        } else {
+            // make sure that any pending instructions are done and all memory transactions committed.
+            _mm_mfence();
+            _mm_lfence();
+            endTime = Clock::now();
+        }
         if (state == State::STARTED) {
             state = State::READY;
         } else {
             FATAL_ERROR("Timer measureEnd called without measureStart\n");
         }
+        if (monitorOsNoise) {
+            OsNoiseMonitor::measureEnd();
+        }
+        if (traceSpans) {
+            TraceRecorder::recordSpan("Timer", traceBeginNs, TraceRecorder::now(), traceIteration++);
+        }
         if (this->markTimers) {
             printf("\n Timer END \n");
         }
     }
 
     Clock::duration get() const {
+        if (useTsc) {
+            if (endTicks <= startTicks + subtractedTicks) {
+                return std::chrono::nanoseconds(1);
+            }
+            return std::max<Clock::duration>(TscClock::toDuration(endTicks - startTicks - subtractedTicks), std::chrono::nanoseconds(1));
+        }
         if (endTime <= startTime) {
             return std::chrono::nanoseconds(1);
         }
@@ -67,6 +104,14 @@ class Timer {
 
   private:
     bool markTimers = false;
+    bool monitorOsNoise = false;
+    bool traceSpans = false;
+    uint64_t traceBeginNs = 0;
+    size_t traceIteration = 0;
+    bool useTsc = false;
+    uint64_t subtractedTicks = 0;
+    uint64_t startTicks = 0;
+    uint64_t endTicks = 0;
     Clock::time_point startTime;
     Clock::time_point endTime;
 
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "trace_recorder.h"
+
+#include "framework/configuration.h"
+#include "framework/utility/file_helper.h"
+#include "framework/utility/json_helper.h"
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#ifdef _WIN32
+#include "framework/utility/windows/windows.h"
+#else
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+struct Span {
+    const char *name;
+    uint64_t beginNs;
+    uint64_t endNs;
+    size_t iteration;
+    uint64_t threadId;
+};
+
+struct ThreadBuffer {
+    std::vector<Span> spans = {};
+    std::atomic<bool> owned = false;
+    ThreadBuffer *next = nullptr;
+};
+
+// Buffers are never freed. A thread which exits hands its buffer over to the next new thread, so
+// benchmarks spawning threads in every iteration do not grow the list. New buffers are pushed to
+// the front of the list and existing ones are claimed with a compare-and-swap, without a mutex.
+std::atomic<ThreadBuffer *> threadBuffers = nullptr;
+
+uint64_t testBeginNs = 0;
+bool traceOutputCreated = false;
+bool eventWritten = false;
+
+uint64_t getThreadId() {
+#ifdef _WIN32
+    return GetCurrentThreadId();
+#else
+    return static_cast<uint64_t>(syscall(SYS_gettid));
+#endif
+}
+
+uint64_t getProcessId() {
+#ifdef _WIN32
+    return GetCurrentProcessId();
+#else
+    return static_cast<uint64_t>(getpid());
+#endif
+}
+
+struct ThreadState {
+    ThreadState() : threadId(getThreadId()) {
+        for (ThreadBuffer *threadBuffer = threadBuffers.load(std::memory_order_acquire); threadBuffer != nullptr; threadBuffer = threadBuffer->next) {
+            if (!threadBuffer->owned.exchange(true, std::memory_order_acquire)) {
+                buffer = threadBuffer;
+                return;
+            }
+        }
+        buffer = new ThreadBuffer();
+        buffer->owned = true;
+        buffer->next = threadBuffers.load(std::memory_order_relaxed);
+        while (!threadBuffers.compare_exchange_weak(buffer->next, buffer, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+    ~ThreadState() {
+        buffer->owned.store(false, std::memory_order_release);
+    }
+
+    ThreadBuffer *buffer = nullptr;
+    const uint64_t threadId;
+};
+
+// Chrome trace timestamps are in microseconds
+std::string toMicroseconds(uint64_t nanoseconds) {
+    std::ostringstream result;
+    result << nanoseconds / 1000 << '.' << std::setw(3) << std::setfill('0') << nanoseconds % 1000;
+    return result.str();
+}
+
+void writeCompleteEvent(std::ostringstream &events, std::string_view quotedName, const char *category, uint64_t beginNs, uint64_t endNs,
+                        uint64_t processId, uint64_t threadId, const std::string &args) {
+    events << (eventWritten ? ",\n" : "")
+           << "{\"name\":" << quotedName << ",\"cat\":\"" << category << "\",\"ph\":\"X\""
+           << ",\"ts\":" << toMicroseconds(beginNs) << ",\"dur\":" << toMicroseconds(endNs > beginNs ? endNs - beginNs : 0)
+           << ",\"pid\":" << processId << ",\"tid\":" << threadId << ",\"args\":{" << args << "}}";
+    eventWritten = true;
+}
+} // namespace
+
+bool TraceRecorder::isEnabled() {
+    return !static_cast<const std::string &>(Configuration::get().traceOutput).empty();
+}
+
+uint64_t TraceRecorder::now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void TraceRecorder::recordSpan(const char *name, uint64_t beginNs, uint64_t endNs, size_t iteration) {
+    thread_local ThreadState threadState{};
+    threadState.buffer->spans.push_back({name, beginNs, endNs, iteration, threadState.threadId});
+}
+
+void TraceRecorder::startTest() {
+    testBeginNs = now();
+}
+
+void TraceRecorder::finishTest(const std::string &testCaseName) {
+    const uint64_t testEndNs = now();
+
+    // Tests which were filtered out or skipped are not written
+    bool anySpans = false;
+    for (const ThreadBuffer *threadBuffer = threadBuffers.load(std::memory_order_acquire); threadBuffer != nullptr; threadBuffer = threadBuffer->next) {
+        anySpans |= !threadBuffer->spans.empty();
+    }
+    if (!anySpans) {
+        return;
+    }
+
+    std::ostringstream events;
+    const bool truncate = !traceOutputCreated;
+    if (truncate) {
+        events << "[\n";
+        eventWritten = false;
+    }
+
+    const std::string quotedTestName = JsonHelper::toString(testCaseName);
+    const uint64_t processId = getProcessId();
+    writeCompleteEvent(events, quotedTestName, "test", testBeginNs, testEndNs, processId, getThreadId(), "");
+    for (ThreadBuffer *threadBuffer = threadBuffers.load(std::memory_order_acquire); threadBuffer != nullptr; threadBuffer = threadBuffer->next) {
+        for (const Span &span : threadBuffer->spans) {
+            const std::string args = "\"test\":" + quotedTestName + ",\"iteration\":" + std::to_string(span.iteration);
+            writeCompleteEvent(events, JsonHelper::toString(span.name), "profiler", span.beginNs, span.endNs, processId, span.threadId, args);
+        }
+        threadBuffer->spans.clear();
+    }
+
+    const std::string &filePath = Configuration::get().traceOutput;
+    if (!FileHelper::appendToFile(filePath, events.str(), truncate)) {
+        std::cerr << "ERROR: cannot open trace output file: " << filePath << '\n';
+        return;
+    }
+    traceOutputCreated = true;
+}
+
+void TraceRecorder::finishTrace() {
+    if (!traceOutputCreated) {
+        return;
+    }
+    const std::string &filePath = Configuration::get().traceOutput;
+    if (!FileHelper::appendToFile(filePath, "\n]\n")) {
+        std::cerr << "ERROR: cannot open trace output file: " << filePath << '\n';
+    }
+    traceOutputCreated = false;
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Records spans measured by Timer, CpuCounter and CpuCounterGroup when --traceOutput is passed and
+// writes them as Chrome trace events after each test, so a run can be loaded in Perfetto or
+// chrome://tracing. Every thread appends to its own buffer, claimed on its first span with a
+// compare-and-swap instead of a mutex - only allocating a new buffer may lock inside the allocator.
+// Buffers are only read by TestCase::run after the benchmark returned, when its worker threads have
+// been joined.
+//
+// The file is a JSON array closed at the end of the run. Trace viewers also accept it without the
+// closing bracket, so the trace of a run killed in the middle can still be loaded.
+class TraceRecorder {
+  public:
+    static bool isEnabled();
+
+    // Steady clock in nanoseconds, the same time base as --timelineOutput
+    static uint64_t now();
+
+    // name has to be a string literal, it is stored without copying
+    static void recordSpan(const char *name, uint64_t beginNs, uint64_t endNs, size_t iteration);
+
+    static void startTest();
+    static void finishTest(const std::string &testCaseName);
+    static void finishTrace();
+};
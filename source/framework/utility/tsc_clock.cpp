@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tsc_clock.h"
+
+#include "framework/configuration.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <ctime>
+#if TSC_CLOCK_AVAILABLE
+#include <cpuid.h>
+#endif
+#endif
+
+const TscClock::Calibration &TscClock::getCalibration() {
+    static const Calibration calibration = calibrate();
+    return calibration;
+}
+
+std::string TscClock::getDescription() {
+    const Calibration &calibration = getCalibration();
+    const double overheadNs = static_cast<double>(calibration.overheadTicks) / calibration.ticksPerNanosecond;
+
+    std::ostringstream description{};
+    description << std::fixed << std::setprecision(3);
+#if TSC_CLOCK_AVAILABLE
+    description << "Timer: TSC at " << calibration.ticksPerNanosecond << " GHz";
+    if (!calibration.invariant) {
+        description << " (WARNING: not invariant, results depend on CPU frequency)";
+    }
+#else
+    description << "Timer: steady clock, TSC is not available on this architecture";
+#endif
+    description << std::setprecision(1) << ", empty measurement takes " << overheadNs << " ns";
+    if (Configuration::get().subtractTimerOverhead) {
+        description << " and is subtracted from results";
+    }
+    return description.str();
+}
+
+TscClock::Calibration TscClock::calibrate() {
+    Calibration calibration{};
+    calibration.invariant = isInvariant();
+
+#if TSC_CLOCK_AVAILABLE
+    // The counter is read between two reads of the reference clock, so each pair is known to within
+    // the cost of one clock read. Over 20ms that is well below 1ppm.
+    const auto readPair = [](uint64_t &ticks, uint64_t &nanoseconds) {
+        const uint64_t before = getReferenceNanoseconds();
+        ticks = read();
+        const uint64_t after = getReferenceNanoseconds();
+        nanoseconds = before + (after - before) / 2;
+    };
+    uint64_t startTicks = 0, startNanoseconds = 0;
+    uint64_t endTicks = 0, endNanoseconds = 0;
+    readPair(startTicks, startNanoseconds);
+    while (getReferenceNanoseconds() - startNanoseconds < 20'000'000) {
+    }
+    readPair(endTicks, endNanoseconds);
+    calibration.ticksPerNanosecond = static_cast<double>(endTicks - startTicks) / static_cast<double>(endNanoseconds - startNanoseconds);
+#endif
+
+    // Median is used, since a single interrupt makes an empty measurement thousands of times longer
+    constexpr size_t overheadSamplesCount = 10001;
+    std::vector<uint64_t> overheads(overheadSamplesCount);
+    for (uint64_t &overhead : overheads) {
+        const uint64_t start = read();
+        const uint64_t end = read();
+        overhead = end - start;
+    }
+    std::nth_element(overheads.begin(), overheads.begin() + overheadSamplesCount / 2, overheads.end());
+    calibration.overheadTicks = overheads[overheadSamplesCount / 2];
+
+    return calibration;
+}
+
+uint64_t TscClock::getReferenceNanoseconds() {
+#if defined(_WIN32)
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#else
+    // Unlike CLOCK_MONOTONIC, the raw clock is not slewed by NTP during calibration
+    timespec time{};
+    clock_gettime(CLOCK_MONOTONIC_RAW, &time);
+    return static_cast<uint64_t>(time.tv_sec) * 1'000'000'000ull + static_cast<uint64_t>(time.tv_nsec);
+#endif
+}
+
+bool TscClock::isInvariant() {
+#if !TSC_CLOCK_AVAILABLE
+    return true;
+#elif defined(_WIN32)
+    int registers[4] = {};
+    __cpuid(registers, 0x80000000);
+    if (static_cast<unsigned int>(registers[0]) < 0x80000007) {
+        return false;
+    }
+    __cpuid(registers, 0x80000007);
+    return (registers[3] & (1 << 8)) != 0;
+#else
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0) {
+        return false;
+    }
+    return (edx & (1 << 8)) != 0;
+#endif
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define TSC_CLOCK_AVAILABLE 1
+#if defined(_WIN32)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#else
+#define TSC_CLOCK_AVAILABLE 0
+#endif
+
+// Time stamp counter of x86 CPUs, used by Timer when --profilerType=tsc is passed. Reading it costs
+// a few nanoseconds, while the default Timer fences and calls the system clock on both ends. Ticks
+// are converted to time with a frequency calibrated against CLOCK_MONOTONIC_RAW on first use. Cost
+// of an empty measurement is calibrated along with it, so it can be reported and subtracted. On
+// other architectures the steady clock is read instead, with one tick per nanosecond.
+struct TscClock {
+    struct Calibration {
+        double ticksPerNanosecond = 1;
+        uint64_t overheadTicks = 0; // median of empty measureStart/measureEnd pairs
+        bool invariant = false;     // frequency does not change with P-states and C-states
+    };
+
+    static const Calibration &getCalibration();
+    static std::string getDescription();
+
+    static inline uint64_t read() {
+#if TSC_CLOCK_AVAILABLE
+        // rdtscp waits for preceding instructions, the fence keeps following ones from starting early
+        unsigned int processorId = 0;
+        const uint64_t ticks = __rdtscp(&processorId);
+        _mm_lfence();
+        return ticks;
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    static std::chrono::nanoseconds toDuration(uint64_t ticks) {
+        return std::chrono::nanoseconds(static_cast<int64_t>(static_cast<double>(ticks) / getCalibration().ticksPerNanosecond + 0.5));
+    }
+
+  private:
+    static Calibration calibrate();
+    static uint64_t getReferenceNanoseconds();
+    static bool isInvariant();
+};
@@ -5,7 +5,7 @@
  *
  */
 
-#include "framework/utility/windows/cpu_time_timer.h"
+#include "framework/utility/cpu_time_timer.h"
 
 #include "framework/utility/error.h"
 #include "framework/utility/windows/windows.h"
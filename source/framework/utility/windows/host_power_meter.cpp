@@ -0,0 +1,32 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/host_power_meter.h"
+
+#include <iostream>
+
+HostPowerMeter::HostPowerMeter() {
+    static bool warningPrinted = false;
+    if (!warningPrinted) {
+        std::cerr << "WARNING: --measureHostPower is not supported on Windows, host power will not be measured\n";
+        warningPrinted = true;
+    }
+}
+
+HostPowerMeter::~HostPowerMeter() = default;
+
+void HostPowerMeter::openEnergyZones() {}
+
+void HostPowerMeter::openFrequencyCounters() {}
+
+uint64_t HostPowerMeter::readEnergy(const EnergyZone &, uint64_t) {
+    return 0;
+}
+
+uint64_t HostPowerMeter::readCounter(int) {
+    return 0;
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/mapped_file.h"
+
+#include "framework/utility/windows/windows.h"
+
+MappedFile::MappedFile(const std::string &filePath) {
+    const HANDLE file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return;
+    }
+
+    LARGE_INTEGER fileSize{};
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart == 0) {
+        // An empty file cannot be mapped, but is open nonetheless
+        this->open = true;
+    } else if (fileSize.QuadPart > 0) {
+        // The view keeps the file and the mapping alive after their handles are closed
+        const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping != nullptr) {
+            const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (view != nullptr) {
+                this->data = static_cast<const uint8_t *>(view);
+                this->size = static_cast<size_t>(fileSize.QuadPart);
+                this->open = true;
+            }
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+}
+
+MappedFile::~MappedFile() {
+    if (data != nullptr) {
+        UnmapViewOfFile(data);
+    }
+}
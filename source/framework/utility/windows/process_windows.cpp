@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@ struct ProcessDataWindows {
     bool hasResult = false;
     TestResult result = TestResult::Error;
     std::string stdOut = {};
+    std::string terminationReason = {};
 };
 
 class EnvironmentRestorer {
@@ -95,9 +96,11 @@ void Process::run() {
     FATAL_ERROR_IF_SYS_CALL_FAILED(SetHandleInformation(processDataWindows->processStdOut.read, HANDLE_FLAG_INHERIT, 0), "setting handle inheritance")
 
     // Prepare arguments
-    this->addArgument("synchronizationPipeIn", "0");
-    this->addArgument("synchronizationPipeOut", "0");
-    this->addArgument("measurementPipe", "0");
+    if (this->synchronizationArguments) {
+        this->addArgument("synchronizationPipeIn", "0");
+        this->addArgument("synchronizationPipeOut", "0");
+        this->addArgument("measurementPipe", "0");
+    }
     std::ostringstream commandLine{};
     for (const auto &argument : this->arguments) {
         commandLine << argument.first;
@@ -186,6 +189,44 @@ void Process::waitForFinish() {
     processDataWindows->ended = true;
 }
 
+bool Process::waitForFinishOrKill(std::chrono::milliseconds timeout) {
+    ProcessDataWindows *processDataWindows = static_cast<ProcessDataWindows *>(this->osSpecificData);
+    FATAL_ERROR_IF(processDataWindows->ended, "Process was already waited for");
+
+    // Stdout is drained by asyncReadThread in the meantime
+    const DWORD waitTime = timeout.count() > 0 ? static_cast<DWORD>(timeout.count()) : INFINITE;
+    const DWORD waitResult = WaitForSingleObject(processDataWindows->processInfo.hProcess, waitTime);
+    const bool timedOut = waitResult == WAIT_TIMEOUT;
+    if (timedOut) {
+        FATAL_ERROR_IF_SYS_CALL_FAILED(TerminateProcess(processDataWindows->processInfo.hProcess, static_cast<UINT>(TestResult::Error)), "terminating process");
+    } else if (waitResult != WAIT_OBJECT_0) {
+        FATAL_ERROR(std::string("waiting for process to end, ") + getErrorFromLastErrorCode());
+    }
+    waitForFinish();
+
+    DWORD exitCode{};
+    FATAL_ERROR_IF_SYS_CALL_FAILED(GetExitCodeProcess(processDataWindows->processInfo.hProcess, &exitCode), "retrieving process exit code");
+    processDataWindows->hasResult = true;
+    if (timedOut) {
+        processDataWindows->result = TestResult::Error;
+        processDataWindows->terminationReason = "timed out after " + std::to_string(timeout.count()) + "ms";
+    } else if (exitCode >= 0xC0000000) {
+        // Unhandled exceptions end the process with their NTSTATUS code, e.g. 0xC0000005 for an access violation
+        std::ostringstream reason{};
+        reason << "crashed with exception 0x" << std::hex << exitCode;
+        processDataWindows->result = TestResult::Error;
+        processDataWindows->terminationReason = reason.str();
+    } else {
+        processDataWindows->result = static_cast<TestResult>(exitCode);
+    }
+    return !timedOut;
+}
+
+const std::string &Process::getTerminationReason() {
+    ProcessDataWindows *processDataWindows = static_cast<ProcessDataWindows *>(this->osSpecificData);
+    return processDataWindows->terminationReason;
+}
+
 TestResult Process::getResult() {
     ProcessDataWindows *processDataWindows = static_cast<ProcessDataWindows *>(this->osSpecificData);
     if (!processDataWindows->hasResult) {
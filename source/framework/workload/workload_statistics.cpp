@@ -50,6 +50,12 @@ void WorkloadStatistics::pushCpuCounter([[maybe_unused]] uint64_t count, [[maybe
     FATAL_ERROR("Not implemented");
 }
 
+void WorkloadStatistics::pushRatio([[maybe_unused]] double value, [[maybe_unused]] MeasurementUnit unit, MeasurementType type, std::string_view description) {
+    FATAL_ERROR_IF(type != MeasurementType::Unknown, "WorkloadStatistics does not support setting measurement type");
+    FATAL_ERROR_IF(description != "", "WorkloadStatistics does not support multiple statistics groups");
+    FATAL_ERROR("Not implemented");
+}
+
 void WorkloadStatistics::pushEnergy([[maybe_unused]] size_t microJoules,
                                     [[maybe_unused]] MeasurementUnit unit,
                                     MeasurementType type,
@@ -70,6 +76,22 @@ void WorkloadStatistics::pushEnergy([[maybe_unused]] double watts,
 
 void WorkloadStatistics::pushUnitAndType([[maybe_unused]] MeasurementUnit unit, [[maybe_unused]] MeasurementType type) {}
 
+Statistics::MetricHandle WorkloadStatistics::registerMetric([[maybe_unused]] MeasurementUnit unit, [[maybe_unused]] MeasurementType type, [[maybe_unused]] std::string_view description) {
+    FATAL_ERROR("Not implemented");
+}
+
+void WorkloadStatistics::pushValue([[maybe_unused]] MetricHandle metric, [[maybe_unused]] Clock::duration time) {
+    FATAL_ERROR("Not implemented");
+}
+
+void WorkloadStatistics::pushValue([[maybe_unused]] MetricHandle metric, [[maybe_unused]] Clock::duration time, [[maybe_unused]] uint64_t size) {
+    FATAL_ERROR("Not implemented");
+}
+
+void WorkloadStatistics::pushPercentage([[maybe_unused]] MetricHandle metric, [[maybe_unused]] double value) {
+    FATAL_ERROR("Not implemented");
+}
+
 bool WorkloadStatistics::isEmpty() const {
     return samplesCount == 0;
 }
@@ -78,6 +100,10 @@ bool WorkloadStatistics::isFull() const {
     return samplesCount == maxSamplesCount;
 }
 
+bool WorkloadStatistics::needsMoreSamples() const {
+    return samplesCount < maxSamplesCount;
+}
+
 void WorkloadStatistics::printStatistics(WorkloadIo &io) {
     io.writeToMeasurements(result.str());
 }
@@ -25,12 +25,18 @@ class WorkloadStatistics : public Statistics {
     void pushValue(Clock::duration time, MeasurementUnit unit, MeasurementType type, std::string_view description = "") override;
     void pushValue(Clock::duration time, uint64_t size, MeasurementUnit unit, MeasurementType type, std::string_view description = "") override;
     void pushCpuCounter(uint64_t count, MeasurementUnit unit, MeasurementType type, std::string_view description = "") override;
+    void pushRatio(double value, MeasurementUnit unit, MeasurementType type, std::string_view description = "") override;
     virtual void pushEnergy(size_t microJoules, MeasurementUnit unit, MeasurementType type, std::string_view description = "") override;
     virtual void pushEnergy(double watts, MeasurementUnit unit, MeasurementType type, std::string_view description = "") override;
     void pushUnitAndType(MeasurementUnit unit, MeasurementType type) override;
+    MetricHandle registerMetric(MeasurementUnit unit, MeasurementType type, std::string_view description = "") override;
+    void pushValue(MetricHandle metric, Clock::duration time) override;
+    void pushValue(MetricHandle metric, Clock::duration time, uint64_t size) override;
+    void pushPercentage(MetricHandle metric, double value) override;
 
     bool isEmpty() const override;
     bool isFull() const override;
+    bool needsMoreSamples() const override;
 
   private:
     std::ostringstream result{};
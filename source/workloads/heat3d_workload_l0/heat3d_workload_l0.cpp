@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -54,7 +54,7 @@
  */
 
 #include "framework/l0/levelzero.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 #include "framework/workload/register_workload.h"
 
@@ -528,7 +528,7 @@ static TestResult initParams(ParamsTy &params, const Heat3DArguments &arguments)
         ASSERT_ZE_RESULT_SUCCESS(zeEventCreate(params.barrierEvPool, &barrierEventDesc, &params.barrierEvents[i]));
     }
 
-    auto spirvModule = FileHelper::loadBinaryFile("heat3d_workload.spv");
+    auto spirvModule = KernelRegistry::get("heat3d_workload.spv");
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
     }
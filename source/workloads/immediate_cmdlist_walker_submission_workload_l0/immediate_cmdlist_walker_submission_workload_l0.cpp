@@ -7,7 +7,7 @@
 
 #include "framework/l0/levelzero.h"
 #include "framework/l0/utility/usm_helper.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 #include "framework/workload/register_workload.h"
 
@@ -64,7 +64,7 @@ TestResult run(const ImmediateCmdListWalkerSubmissionArguments &arguments, Stati
     Timer timer{};
 
     // Create kernel
-    const auto kernelBinary = FileHelper::loadBinaryFile("ulls_benchmark_write_one.spv");
+    const auto kernelBinary = KernelRegistry::get("ulls_benchmark_write_one.spv");
     if (kernelBinary.size() == 0) {
         return TestResult::KernelNotFound;
     }
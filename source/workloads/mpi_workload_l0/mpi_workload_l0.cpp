@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,7 +10,7 @@
 #include "framework/l0/levelzero.h"
 #include "framework/l0/utility/error.h"
 #include "framework/l0/utility/error_codes.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/workload/register_workload.h"
 
 #include <algorithm>
@@ -380,7 +380,7 @@ TestResult testOverlap(const MpiArguments &arguments) {
         queueDesc.priority = ZE_COMMAND_QUEUE_PRIORITY_NORMAL;
         ASSERT_ZE_RESULT_SUCCESS(zeCommandListCreateImmediate(levelzero.context, levelzero.device, &queueDesc, &cmdListImmSync));
 
-        auto spirvModule = FileHelper::loadBinaryFile("mpi_workload_dummy_compute.spv");
+        auto spirvModule = KernelRegistry::get("mpi_workload_dummy_compute.spv");
         if (spirvModule.size() == 0) {
             return TestResult::KernelNotFound;
         }
@@ -6,7 +6,7 @@
  */
 
 #include "framework/l0/levelzero.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/kernel_registry.h"
 #include "framework/utility/timer.h"
 #include "framework/workload/register_workload.h"
 
@@ -58,7 +58,7 @@ TestResult run(const SingleQueueWorkloadSharedBufferArguments &arguments, Statis
     ZE_RESULT_SUCCESS_OR_RETURN_ERROR(zeContextMakeMemoryResident(levelzero.context, levelzero.device, bufferBase, bufferSizeInBytes));
 
     // Create kernel
-    auto spirvModule = FileHelper::loadBinaryFile("single_queue_workload_increment.spv");
+    auto spirvModule = KernelRegistry::get("single_queue_workload_increment.spv");
     if (spirvModule.size() == 0) {
         return TestResult::KernelNotFound;
     }